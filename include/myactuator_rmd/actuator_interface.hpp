@@ -13,6 +13,7 @@
 #include <chrono>
 #include <cstdint>
 #include <string>
+#include <utility>
 
 #include "myactuator_rmd/actuator_state/acceleration_type.hpp"
 #include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
@@ -22,18 +23,29 @@
 #include "myactuator_rmd/actuator_state/motor_status_1.hpp"
 #include "myactuator_rmd/actuator_state/motor_status_2.hpp"
 #include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/actuator_state/raw_feedback.hpp"
 #include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/protocol/command_traits.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/exceptions.hpp"
 
 
 namespace myactuator_rmd {
 
-  /**\class ActuatorInterface
+  /**\class BasicActuatorInterface
    * \brief
    *    Actuator for commanding the MyActuator RMD actuator series
+   *
+   * \tparam DriverT
+   *    The type of the driver communicating with the actuator, calls to a final driver such as the CanDriver are
+   *    dispatched statically while the ActuatorInterface works with any Driver through virtual calls
   */
-  class ActuatorInterface {
+  template <typename DriverT>
+  class BasicActuatorInterface {
     public:
-      /**\fn ActuatorInterface
+      /**\fn BasicActuatorInterface
        * \brief
        *    Class constructor
        * 
@@ -42,12 +54,26 @@ namespace myactuator_rmd {
        * \param[in] actuator_id
        *    The actuator id [1, 32]
       */
-      ActuatorInterface(Driver& driver, std::uint32_t const actuator_id);
-      ActuatorInterface() = delete;
-      ActuatorInterface(ActuatorInterface const&) = default;
-      ActuatorInterface& operator = (ActuatorInterface const&) = default;
-      ActuatorInterface(ActuatorInterface&&) = default;
-      ActuatorInterface& operator = (ActuatorInterface&&) = default;
+      BasicActuatorInterface(DriverT& driver, std::uint32_t const actuator_id);
+      BasicActuatorInterface() = delete;
+      BasicActuatorInterface(BasicActuatorInterface const&) = default;
+      BasicActuatorInterface& operator = (BasicActuatorInterface const&) = default;
+      BasicActuatorInterface(BasicActuatorInterface&&) = default;
+      BasicActuatorInterface& operator = (BasicActuatorInterface&&) = default;
+
+      /**\fn call
+       * \brief
+       *    Sends an arbitrary command registered in the CommandTraits to the actuator and decodes its response
+       * 
+       * \tparam C
+       *    The type of the command that should be sent
+       * \param[in] args
+       *    The arguments the request should be constructed from
+       * \return
+       *    The decoded response
+      */
+      template <CommandType C, typename... Args>
+      typename CommandTraits<C>::Result call(Args&&... args);
 
       /**\fn getAcceleration
        * \brief
@@ -129,6 +155,16 @@ namespace myactuator_rmd {
       [[nodiscard]]
       MotorStatus2 getMotorStatus2();
 
+      /**\fn getMotorStatus2Raw
+       * \brief
+       *    Reads the motor status 2 in the fixed-point units of the protocol without any conversion to floating point
+       * 
+       * \return
+       *    The raw motor status 2 containing current, speed and position
+      */
+      [[nodiscard]]
+      RawFeedback getMotorStatus2Raw();
+
       /**\fn getMotorStatus3
        * \brief
        *    Reads the motor status 3
@@ -250,6 +286,17 @@ namespace myactuator_rmd {
       */
       Feedback sendCurrentSetpoint(float const current);
 
+      /**\fn sendCurrentSetpointRaw
+       * \brief
+       *    Send a current set-point in the fixed-point units of the protocol to the actuator
+       *
+       * \param[in] current
+       *    The current set-point in 0.01 Ampere
+       * \return
+       *    Raw feedback control message containing actuator position, velocity, torque and temperature
+      */
+      RawFeedback sendCurrentSetpointRaw(std::int16_t const current);
+
       /**\fn sendPositionAbsoluteSetpoint
        * \brief
        *    Send an absolute position set-point to the actuator additionally specifying a maximum velocity
@@ -263,6 +310,19 @@ namespace myactuator_rmd {
       */
       Feedback sendPositionAbsoluteSetpoint(float const position, float const max_speed = 500.0);
 
+      /**\fn sendPositionAbsoluteSetpointRaw
+       * \brief
+       *    Send an absolute position set-point in the fixed-point units of the protocol to the actuator
+       *
+       * \param[in] position
+       *    The position set-point in 0.01 degree
+       * \param[in] max_speed
+       *    The maximum speed for the motion in degree per second
+       * \return
+       *    Raw feedback control message containing actuator position, velocity, torque and temperature
+      */
+      RawFeedback sendPositionAbsoluteSetpointRaw(std::int32_t const position, std::uint16_t const max_speed = 500);
+
       /**\fn sendTorqueSetpoint
        * \brief
        *    Send a torque set-point to the actuator by setting the current
@@ -288,6 +348,17 @@ namespace myactuator_rmd {
       */
       Feedback sendVelocitySetpoint(float const speed);
 
+      /**\fn sendVelocitySetpointRaw
+       * \brief
+       *    Send a velocity set-point in the fixed-point units of the protocol to the actuator
+       *
+       * \param[in] speed
+       *    The speed set-point in 0.01 degree per second
+       * \return
+       *    Raw feedback control message containing actuator position, velocity, torque and temperature
+      */
+      RawFeedback sendVelocitySetpointRaw(std::int32_t const speed);
+
       /**\fn setAcceleration
        * \brief
        *    Write the acceleration/deceleration for the different modes to RAM and ROM (persistent)
@@ -377,10 +448,242 @@ namespace myactuator_rmd {
       void stopMotor();
 
     protected:
-      Driver& driver_;
+      DriverT& driver_;
       std::uint32_t actuator_id_;
   };
 
+  /**\typedef ActuatorInterface
+   * \brief
+   *    Actuator interface working with any driver through virtual calls, instantiated in the library
+  */
+  using ActuatorInterface = BasicActuatorInterface<Driver>;
+  extern template class BasicActuatorInterface<Driver>;
+
+  template <typename DriverT>
+  BasicActuatorInterface<DriverT>::BasicActuatorInterface(DriverT& driver, std::uint32_t const actuator_id)
+  : driver_{driver}, actuator_id_{actuator_id} {
+    driver.addId(actuator_id); // Make the actuator listen to the responses
+    return;
+  }
+
+  template <typename DriverT>
+  template <CommandType C, typename... Args>
+  typename CommandTraits<C>::Result BasicActuatorInterface<DriverT>::call(Args&&... args) {
+    return myactuator_rmd::call<C>(driver_, actuator_id_, std::forward<Args>(args)...);
+  }
+
+  template <typename DriverT>
+  std::int32_t BasicActuatorInterface<DriverT>::getAcceleration() {
+    return call<CommandType::READ_ACCELERATION>();
+  }
+
+  template <typename DriverT>
+  std::uint16_t BasicActuatorInterface<DriverT>::getCanId() {
+    GetCanIdRequest const request {};
+    GetCanIdResponse const response {driver_.sendRecv(request, actuator_id_)};
+    return response.getCanId();
+  }
+
+  template <typename DriverT>
+  Gains BasicActuatorInterface<DriverT>::getControllerGains() {
+    return call<CommandType::READ_PID_PARAMETERS>();
+  }
+
+  template <typename DriverT>
+  ControlMode BasicActuatorInterface<DriverT>::getControlMode() {
+    return call<CommandType::READ_SYSTEM_OPERATING_MODE>();
+  }
+
+  template <typename DriverT>
+  std::string BasicActuatorInterface<DriverT>::getMotorModel() {
+    return call<CommandType::READ_MOTOR_MODEL>();
+  }
+
+  template <typename DriverT>
+  float BasicActuatorInterface<DriverT>::getMotorPower() {
+    return call<CommandType::READ_MOTOR_POWER>();
+  }
+
+  template <typename DriverT>
+  MotorStatus1 BasicActuatorInterface<DriverT>::getMotorStatus1() {
+    return call<CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG>();
+  }
+
+  template <typename DriverT>
+  MotorStatus2 BasicActuatorInterface<DriverT>::getMotorStatus2() {
+    return call<CommandType::READ_MOTOR_STATUS_2>();
+  }
+
+  template <typename DriverT>
+  RawFeedback BasicActuatorInterface<DriverT>::getMotorStatus2Raw() {
+    GetMotorStatus2Request const request {};
+    GetMotorStatus2Response const response {driver_.sendRecv(request, actuator_id_)};
+    return response.getStatusRaw();
+  }
+
+  template <typename DriverT>
+  MotorStatus3 BasicActuatorInterface<DriverT>::getMotorStatus3() {
+    return call<CommandType::READ_MOTOR_STATUS_3>();
+  }
+
+  template <typename DriverT>
+  float BasicActuatorInterface<DriverT>::getMultiTurnAngle() {
+    return call<CommandType::READ_MULTI_TURN_ANGLE>();
+  }
+
+  template <typename DriverT>
+  std::int32_t BasicActuatorInterface<DriverT>::getMultiTurnEncoderPosition() {
+    return call<CommandType::READ_MULTI_TURN_ENCODER_POSITION>();
+  }
+
+  template <typename DriverT>
+  std::int32_t BasicActuatorInterface<DriverT>::getMultiTurnEncoderOriginalPosition() {
+    return call<CommandType::READ_MULTI_TURN_ENCODER_ORIGINAL_POSITION>();
+  }
+
+  template <typename DriverT>
+  std::int32_t BasicActuatorInterface<DriverT>::getMultiTurnEncoderZeroOffset() {
+    return call<CommandType::READ_MULTI_TURN_ENCODER_ZERO_OFFSET>();
+  }
+
+  template <typename DriverT>
+  std::chrono::milliseconds BasicActuatorInterface<DriverT>::getRuntime() {
+    return call<CommandType::READ_SYSTEM_RUNTIME>();
+  }
+
+  template <typename DriverT>
+  float BasicActuatorInterface<DriverT>::getSingleTurnAngle() {
+    return call<CommandType::READ_SINGLE_TURN_ANGLE>();
+  }
+
+  template <typename DriverT>
+  std::int16_t BasicActuatorInterface<DriverT>::getSingleTurnEncoderPosition() {
+    return call<CommandType::READ_SINGLE_TURN_ENCODER>();
+  }
+
+  template <typename DriverT>
+  std::uint32_t BasicActuatorInterface<DriverT>::getVersionDate() {
+    return call<CommandType::READ_SYSTEM_SOFTWARE_VERSION_DATE>();
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::lockBrake() {
+    call<CommandType::LOCK_BRAKE>();
+    return;
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::releaseBrake() {
+    call<CommandType::RELEASE_BRAKE>();
+    return;
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::reset() {
+    call<CommandType::RESET_SYSTEM>();
+    return;
+  }
+
+  template <typename DriverT>
+  Feedback BasicActuatorInterface<DriverT>::sendCurrentSetpoint(float const current) {
+    return call<CommandType::TORQUE_CLOSED_LOOP_CONTROL>(current);
+  }
+
+  template <typename DriverT>
+  RawFeedback BasicActuatorInterface<DriverT>::sendCurrentSetpointRaw(std::int16_t const current) {
+    auto const request {SetTorqueRequest::fromRaw(current)};
+    SetTorqueResponse const response {driver_.sendRecv(request, actuator_id_)};
+    return response.getStatusRaw();
+  }
+
+  template <typename DriverT>
+  Feedback BasicActuatorInterface<DriverT>::sendPositionAbsoluteSetpoint(float const position, float const max_speed) {
+    return call<CommandType::ABSOLUTE_POSITION_CLOSED_LOOP_CONTROL>(position, max_speed);
+  }
+
+  template <typename DriverT>
+  RawFeedback BasicActuatorInterface<DriverT>::sendPositionAbsoluteSetpointRaw(std::int32_t const position,
+                                                                               std::uint16_t const max_speed) {
+    auto const request {SetPositionAbsoluteRequest::fromRaw(position, max_speed)};
+    SetPositionAbsoluteResponse const response {driver_.sendRecv(request, actuator_id_)};
+    return response.getStatusRaw();
+  }
+
+  template <typename DriverT>
+  Feedback BasicActuatorInterface<DriverT>::sendTorqueSetpoint(float const torque, float const torque_constant) {
+    auto const current {torque/torque_constant};
+    return sendCurrentSetpoint(current);
+  }
+
+  template <typename DriverT>
+  Feedback BasicActuatorInterface<DriverT>::sendVelocitySetpoint(float const speed) {
+    return call<CommandType::SPEED_CLOSED_LOOP_CONTROL>(speed);
+  }
+
+  template <typename DriverT>
+  RawFeedback BasicActuatorInterface<DriverT>::sendVelocitySetpointRaw(std::int32_t const speed) {
+    auto const request {SetVelocityRequest::fromRaw(speed)};
+    SetVelocityResponse const response {driver_.sendRecv(request, actuator_id_)};
+    return response.getStatusRaw();
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::setAcceleration(std::uint32_t const acceleration, AccelerationType const mode) {
+    call<CommandType::WRITE_ACCELERATION_TO_RAM_AND_ROM>(acceleration, mode);
+    return;
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::setCanId(std::uint16_t const can_id) {
+    SetCanIdRequest const request {can_id};
+    [[maybe_unused]] SetCanIdResponse const response {driver_.sendRecv(request, actuator_id_)};
+    return;
+  }
+
+  template <typename DriverT>
+  std::int32_t BasicActuatorInterface<DriverT>::setCurrentPositionAsEncoderZero() {
+    return call<CommandType::WRITE_CURRENT_MULTI_TURN_POSITION_TO_ROM_AS_ZERO>();
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::setEncoderZero(std::int32_t const encoder_offset) {
+    call<CommandType::WRITE_ENCODER_MULTI_TURN_VALUE_TO_ROM_AS_ZERO>(encoder_offset);
+    return;
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::setCanBaudRate(CanBaudRate const baud_rate) {
+    call<CommandType::COMMUNICATION_BAUD_RATE_SETTING>(baud_rate);
+    return;
+  }
+
+  template <typename DriverT>
+  Gains BasicActuatorInterface<DriverT>::setControllerGains(Gains const& gains, bool const is_persistent) {
+    if (is_persistent) {
+      return call<CommandType::WRITE_PID_PARAMETERS_TO_ROM>(gains);
+    } else {
+      return call<CommandType::WRITE_PID_PARAMETERS_TO_RAM>(gains);
+    }
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::setTimeout(std::chrono::milliseconds const& timeout) {
+    call<CommandType::COMMUNICATION_INTERRUPTION_PROTECTION_TIME_SETTING>(timeout);
+    return;
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::shutdownMotor() {
+    call<CommandType::SHUTDOWN_MOTOR>();
+    return;
+  }
+
+  template <typename DriverT>
+  void BasicActuatorInterface<DriverT>::stopMotor() {
+    call<CommandType::STOP_MOTOR>();
+    return;
+  }
+
 }
 
 #endif // MYACTUATOR_RMD__ACTUATOR_INTERFACE
@@ -0,0 +1,58 @@
+/**
+ * \file raw_feedback.hpp
+ * \mainpage
+ *    Contains the struct for closed-loop control feedback in the fixed-point units of the protocol
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__ACTUATOR_STATE__RAW_FEEDBACK
+#define MYACTUATOR_RMD__ACTUATOR_STATE__RAW_FEEDBACK
+#pragma once
+
+#include <cstdint>
+
+
+namespace myactuator_rmd {
+
+  /**\class RawFeedback
+   * \brief
+   *    Closed-loop control feedback as it is transmitted on the bus, without any conversion to floating point
+  */
+  class RawFeedback {
+    public:
+      /**\fn RawFeedback
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] temperature_
+       *    The temperature of the actuator in degree Celsius
+       * \param[in] current_
+       *    The current currently used by the actuator in 0.01A
+       * \param[in] shaft_speed_
+       *    The output shaft velocity in degree per second
+       * \param[in] shaft_angle_
+       *    The output shaft angle in degrees
+      */
+      constexpr RawFeedback(std::int8_t const temperature_ = 0, std::int16_t const current_ = 0,
+                            std::int16_t const shaft_speed_ = 0, std::int16_t const shaft_angle_ = 0) noexcept;
+      RawFeedback(RawFeedback const&) = default;
+      RawFeedback& operator = (RawFeedback const&) = default;
+      RawFeedback(RawFeedback&&) = default;
+      RawFeedback& operator = (RawFeedback&&) = default;
+
+      std::int8_t temperature;
+      std::int16_t current;
+      std::int16_t shaft_speed;
+      std::int16_t shaft_angle;
+  };
+
+  constexpr RawFeedback::RawFeedback(std::int8_t const temperature_, std::int16_t const current_,
+                                     std::int16_t const shaft_speed_, std::int16_t const shaft_angle_) noexcept
+  : temperature{temperature_}, current{current_}, shaft_speed{shaft_speed_}, shaft_angle{shaft_angle_} {
+    return;
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__ACTUATOR_STATE__RAW_FEEDBACK
@@ -0,0 +1,410 @@
+/**
+ * \file asio_can_driver.hpp
+ * \mainpage
+ *    Contains a header-only CAN driver for Boost.Asio event loops, requires Boost 1.70 or newer
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__ASIO__ASIO_CAN_DRIVER
+#define MYACTUATOR_RMD__ASIO__ASIO_CAN_DRIVER
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/system/error_code.hpp>
+#include <linux/can.h>
+
+#include "myactuator_rmd/can/node.hpp"
+#include "myactuator_rmd/driver/can_address_offset.hpp"
+#include "myactuator_rmd/protocol/command_traits.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class AsioCanDriver
+   * \brief
+   *    Driver that wraps the CAN socket into a Boost.Asio stream descriptor so that the communication with the
+   *    actuators can share an existing event loop instead of requiring dedicated blocking threads.
+   *    Every command of the ActuatorInterface can be sent with asyncCall completing with the decoded result,
+   *    while asyncSendRecv exchanges raw messages. The initiating functions accept any completion token such as
+   *    callbacks, boost::asio::use_future or boost::asio::use_awaitable.
+   *    Similar to other Boost.Asio I/O objects an operation must not be started before the previous one has
+   *    completed.
+  */
+  class AsioCanDriver {
+    public:
+      using executor_type = boost::asio::any_io_executor;
+
+      /**\fn AsioCanDriver
+       * \brief
+       *    Class constructor, opens the socket on the given network interface and only receives responses
+       *
+       * \param[in] executor
+       *    The executor that the asynchronous operations should be run on, e.g. io_context.get_executor()
+       * \param[in] ifname
+       *    The name of the network interface that should be communicated over
+       * \param[in] timeout
+       *    The time to wait for a response until an operation fails with boost::asio::error::timed_out
+      */
+      AsioCanDriver(executor_type const& executor, std::string const& ifname,
+                    std::chrono::microseconds const& timeout = std::chrono::seconds(1));
+
+      /**\fn AsioCanDriver
+       * \brief
+       *    Class constructor taking over an already configured socket
+       *
+       * \param[in] executor
+       *    The executor that the asynchronous operations should be run on, e.g. io_context.get_executor()
+       * \param[in] native_handle
+       *    The file descriptor of the socket that the driver should take the ownership of
+       * \param[in] timeout
+       *    The time to wait for a response until an operation fails with boost::asio::error::timed_out
+      */
+      AsioCanDriver(executor_type const& executor, int const native_handle,
+                    std::chrono::microseconds const& timeout = std::chrono::seconds(1));
+      AsioCanDriver() = delete;
+      AsioCanDriver(AsioCanDriver const&) = delete;
+      AsioCanDriver& operator = (AsioCanDriver const&) = delete;
+      AsioCanDriver(AsioCanDriver&&) = delete;
+      AsioCanDriver& operator = (AsioCanDriver&&) = delete;
+      ~AsioCanDriver() = default;
+
+      /**\fn get_executor
+       * \brief
+       *    Get the executor of the driver as required by Boost.Asio I/O objects
+       *
+       * \return
+       *    The executor that the asynchronous operations are run on
+      */
+      [[nodiscard]]
+      executor_type get_executor() noexcept;
+
+      /**\fn setTimeout
+       * \brief
+       *    Set the time to wait for a response, only affects operations started afterwards
+       *
+       * \param[in] timeout
+       *    The time to wait for a response until an operation fails with boost::asio::error::timed_out
+      */
+      void setTimeout(std::chrono::microseconds const& timeout) noexcept;
+
+      /**\fn asyncSend
+       * \brief
+       *    Sends a message without waiting for a response, completes with the signature
+       *    void(boost::system::error_code)
+       *
+       * \param[in] msg
+       *    The message that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+       * \param[in] token
+       *    The completion token invoked once the message was sent
+       * \return
+       *    Depends on the completion token, e.g. a std::future for boost::asio::use_future
+      */
+      template <typename CompletionToken>
+      auto asyncSend(Message const& msg, std::uint32_t const actuator_id, CompletionToken&& token);
+
+      /**\fn asyncSendRecv
+       * \brief
+       *    Sends a request and waits for the corresponding response of the actuator, completes with the signature
+       *    void(boost::system::error_code, std::array<std::uint8_t,8>). Frames of other actuators or other commands
+       *    are skipped.
+       *
+       * \param[in] request
+       *    Request that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+       * \param[in] token
+       *    The completion token invoked with the response bytes
+       * \return
+       *    Depends on the completion token, e.g. a std::future for boost::asio::use_future
+      */
+      template <typename CompletionToken>
+      auto asyncSendRecv(Message const& request, std::uint32_t const actuator_id, CompletionToken&& token);
+
+      /**\fn asyncCall
+       * \brief
+       *    Sends the command with the given arguments and decodes its response with the command traits. Completes
+       *    with the signature void(boost::system::error_code, CommandTraits<C>::Result), e.g. with the Feedback of
+       *    a set-point, or void(boost::system::error_code) if the command has no result.
+       *
+       * \tparam C
+       *    The type of the command that should be sent
+       * \tparam Args
+       *    The types of the arguments of the request followed by the type of the completion token
+       * \param[in] actuator_id
+       *    The ID of the actuator that the command should be sent to
+       * \param[in] args
+       *    The arguments the request should be constructed from followed by the completion token invoked with
+       *    the decoded result
+       * \return
+       *    Depends on the completion token, e.g. a std::future for boost::asio::use_future
+      */
+      template <CommandType C, typename... Args>
+      auto asyncCall(std::uint32_t const actuator_id, Args&&... args);
+
+    protected:
+      using Clock = boost::asio::steady_timer::clock_type;
+
+      /**\class SendRecvOperation
+       * \brief
+       *    Composed operation writing a request and reading frames until the response has been received
+      */
+      class SendRecvOperation {
+        public:
+          enum class State {
+            STARTING,
+            WRITING,
+            READING
+          };
+
+          template <typename Self>
+          void operator () (Self& self, boost::system::error_code error = {}, std::size_t const num_bytes = 0);
+
+          AsioCanDriver& driver;
+          std::uint32_t response_id;
+          std::uint8_t command;
+          State state;
+      };
+
+      /**\fn asyncCallImpl
+       * \brief
+       *    Constructs the request from all but the last argument and starts the call with the last argument as
+       *    completion token
+       *
+       * \tparam C
+       *    The type of the command that should be sent
+       * \tparam Tuple
+       *    The type of the tuple of references to the arguments
+       * \tparam I
+       *    The indices of the arguments of the request
+       * \param[in] actuator_id
+       *    The ID of the actuator that the command should be sent to
+       * \param[in] args
+       *    The arguments of the request followed by the completion token
+       * \return
+       *    Depends on the completion token, e.g. a std::future for boost::asio::use_future
+      */
+      template <CommandType C, typename Tuple, std::size_t... I>
+      auto asyncCallImpl(std::uint32_t const actuator_id, Tuple&& args, std::index_sequence<I...>);
+
+      /**\fn openSocket
+       * \brief
+       *    Opens a socket on the given network interface only receiving responses of actuators
+       *
+       * \param[in] ifname
+       *    The name of the network interface that should be communicated over
+       * \return
+       *    The file descriptor of the opened socket
+      */
+      [[nodiscard]]
+      static int openSocket(std::string const& ifname);
+
+      /**\fn setRequest
+       * \brief
+       *    Prepares the frame that should be written next
+       *
+       * \param[in] msg
+       *    The message that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+      */
+      void setRequest(Message const& msg, std::uint32_t const actuator_id) noexcept;
+
+      boost::asio::posix::stream_descriptor descriptor_;
+      boost::asio::steady_timer timer_;
+      std::chrono::microseconds timeout_;
+      // The buffers have to outlive the operation and therefore can not be part of it
+      struct ::can_frame request_frame_;
+      struct ::can_frame response_frame_;
+  };
+
+  inline AsioCanDriver::AsioCanDriver(executor_type const& executor, std::string const& ifname,
+                                      std::chrono::microseconds const& timeout)
+  : AsioCanDriver{executor, openSocket(ifname), timeout} {
+    return;
+  }
+
+  inline AsioCanDriver::AsioCanDriver(executor_type const& executor, int const native_handle,
+                                      std::chrono::microseconds const& timeout)
+  : descriptor_{executor, native_handle}, timer_{executor}, timeout_{timeout}, request_frame_{}, response_frame_{} {
+    return;
+  }
+
+  inline AsioCanDriver::executor_type AsioCanDriver::get_executor() noexcept {
+    return descriptor_.get_executor();
+  }
+
+  inline void AsioCanDriver::setTimeout(std::chrono::microseconds const& timeout) noexcept {
+    timeout_ = timeout;
+    return;
+  }
+
+  template <typename CompletionToken>
+  auto AsioCanDriver::asyncSend(Message const& msg, std::uint32_t const actuator_id, CompletionToken&& token) {
+    setRequest(msg, actuator_id);
+    return boost::asio::async_compose<CompletionToken,void(boost::system::error_code)>(
+      [this, is_started = false](auto& self, boost::system::error_code const& error = {}, std::size_t const = 0) mutable {
+        if (!is_started) {
+          is_started = true;
+          boost::asio::async_write(descriptor_, boost::asio::buffer(&request_frame_, sizeof(struct ::can_frame)), std::move(self));
+          return;
+        }
+        self.complete(error);
+        return;
+      }, token, descriptor_);
+  }
+
+  template <typename CompletionToken>
+  auto AsioCanDriver::asyncSendRecv(Message const& request, std::uint32_t const actuator_id, CompletionToken&& token) {
+    setRequest(request, actuator_id);
+    return boost::asio::async_compose<CompletionToken,void(boost::system::error_code,std::array<std::uint8_t,8>)>(
+      SendRecvOperation{*this, CanAddressOffset::response + actuator_id, request.getData()[0], SendRecvOperation::State::STARTING},
+      token, descriptor_);
+  }
+
+  template <CommandType C, typename... Args>
+  auto AsioCanDriver::asyncCall(std::uint32_t const actuator_id, Args&&... args) {
+    static_assert(sizeof...(Args) > 0, "The last argument has to be a completion token");
+    return asyncCallImpl<C>(actuator_id, std::forward_as_tuple(std::forward<Args>(args)...),
+                            std::make_index_sequence<sizeof...(Args) - 1>{});
+  }
+
+  template <CommandType C, typename Tuple, std::size_t... I>
+  auto AsioCanDriver::asyncCallImpl(std::uint32_t const actuator_id, Tuple&& args, std::index_sequence<I...>) {
+    using Traits = CommandTraits<C>;
+    using Result = typename Traits::Result;
+    typename Traits::Request const request(std::get<I>(std::move(args))...);
+    auto&& token {std::get<sizeof...(I)>(std::move(args))};
+    using CompletionToken = decltype(token);
+    if constexpr (!Traits::is_reply_expected) {
+      return asyncSend(request, actuator_id, std::forward<CompletionToken>(token));
+    } else if constexpr (std::is_void_v<Result>) {
+      return boost::asio::async_compose<CompletionToken,void(boost::system::error_code)>(
+        [this, request, actuator_id, is_started = false](auto& self, boost::system::error_code const& error = {},
+                                                         std::array<std::uint8_t,8> const& = {}) mutable {
+          if (!is_started) {
+            is_started = true;
+            asyncSendRecv(request, actuator_id, std::move(self));
+            return;
+          }
+          self.complete(error);
+          return;
+        }, token, descriptor_);
+    } else {
+      return boost::asio::async_compose<CompletionToken,void(boost::system::error_code,Result)>(
+        [this, request, actuator_id, is_started = false](auto& self, boost::system::error_code const& error = {},
+                                                         std::array<std::uint8_t,8> const& response = {}) mutable {
+          if (!is_started) {
+            is_started = true;
+            asyncSendRecv(request, actuator_id, std::move(self));
+            return;
+          }
+          if (error) {
+            self.complete(error, Result{});
+            return;
+          }
+          // The command of the response was checked while receiving so that its constructor can not throw
+          self.complete(error, Traits::decode(typename Traits::Response{response}));
+          return;
+        }, token, descriptor_);
+    }
+  }
+
+  template <typename Self>
+  void AsioCanDriver::SendRecvOperation::operator () (Self& self, boost::system::error_code error, std::size_t const) {
+    switch (state) {
+      case State::STARTING: {
+        state = State::WRITING;
+        boost::asio::async_write(driver.descriptor_, boost::asio::buffer(&driver.request_frame_, sizeof(struct ::can_frame)),
+                                 std::move(self));
+        return;
+      }
+      case State::WRITING: {
+        if (error) {
+          self.complete(error, std::array<std::uint8_t,8>{});
+          return;
+        }
+        state = State::READING;
+        driver.timer_.expires_after(driver.timeout_);
+        driver.timer_.async_wait([&driver = driver](boost::system::error_code const& error) {
+          // The timer might have been restarted by a later operation in the meantime
+          if (!error && (driver.timer_.expiry() <= Clock::now())) {
+            driver.descriptor_.cancel();
+          }
+          return;
+        });
+        break;
+      }
+      case State::READING: {
+        if ((error == boost::asio::error::operation_aborted) && (driver.timer_.expiry() <= Clock::now())) {
+          error = boost::asio::error::timed_out;
+        } else if (!error && (driver.response_frame_.can_id & CAN_ERR_FLAG)) {
+          // The type of the error frame is not preserved, use the blocking CanDriver for a detailed diagnosis
+          error = boost::asio::error::network_down;
+        }
+        if (error) {
+          driver.timer_.cancel();
+          self.complete(error, std::array<std::uint8_t,8>{});
+          return;
+        }
+        if ((driver.response_frame_.can_id == response_id) && (driver.response_frame_.data[0] == command)) {
+          driver.timer_.cancel();
+          std::array<std::uint8_t,8> response {};
+          std::copy(std::begin(driver.response_frame_.data), std::end(driver.response_frame_.data), std::begin(response));
+          self.complete(error, response);
+          return;
+        }
+        // Skip frames of other actuators and stale replies to previous requests
+        break;
+      }
+    }
+    boost::asio::async_read(driver.descriptor_, boost::asio::buffer(&driver.response_frame_, sizeof(struct ::can_frame)),
+                            std::move(self));
+    return;
+  }
+
+  inline int AsioCanDriver::openSocket(std::string const& ifname) {
+    can::Node node {ifname};
+    std::vector<std::uint32_t> can_ids {};
+    for (std::uint32_t actuator_id = 1; actuator_id <= 32; ++actuator_id) {
+      can_ids.emplace_back(CanAddressOffset::response + actuator_id);
+    }
+    node.setRecvFilter(can_ids);
+    return node.release();
+  }
+
+  inline void AsioCanDriver::setRequest(Message const& msg, std::uint32_t const actuator_id) noexcept {
+    request_frame_ = {};
+    request_frame_.can_id = CanAddressOffset::request + actuator_id;
+    request_frame_.len = 8;
+    auto const& data {msg.getData()};
+    std::copy(std::begin(data), std::end(data), std::begin(request_frame_.data));
+    return;
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__ASIO__ASIO_CAN_DRIVER
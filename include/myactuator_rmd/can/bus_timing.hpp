@@ -0,0 +1,91 @@
+/**
+ * \file bus_timing.hpp
+ * \mainpage
+ *    Contains functions for estimating the time CAN frames occupy the bus
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__CAN__BUS_TIMING
+#define MYACTUATOR_RMD__CAN__BUS_TIMING
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+
+
+namespace myactuator_rmd {
+  namespace can {
+
+    /**\fn getBitRate
+     * \brief
+     *    Get the bit rate corresponding to a CAN Baud rate setting
+     *
+     * \param[in] baud_rate
+     *    The Baud rate setting of the bus
+     * \return
+     *    The bit rate in bits per second
+    */
+    [[nodiscard]]
+    constexpr std::uint32_t getBitRate(CanBaudRate const baud_rate) noexcept {
+      switch (baud_rate) {
+        case CanBaudRate::KBPS500:
+          return 500000;
+        case CanBaudRate::MBPS1:
+          return 1000000;
+        default:
+          return 1000000;
+      }
+    }
+
+    /**\fn getFrameBits
+     * \brief
+     *    Get the number of bits of a CAN 2.0A data frame with an 11-bit identifier including the inter-frame space,
+     *    see https://en.wikipedia.org/wiki/CAN_bus#Bit_stuffing
+     *
+     * \param[in] data_length
+     *    The number of data bytes of the frame [0, 8]
+     * \param[in] is_worst_case
+     *    Boolean flag signaling whether the worst-case number of stuff bits should be added
+     * \return
+     *    The number of bits on the bus
+    */
+    [[nodiscard]]
+    constexpr std::size_t getFrameBits(std::size_t const data_length = 8, bool const is_worst_case = true) noexcept {
+      // Start of frame, identifier, RTR, IDE, r0, DLC, data and CRC are subject to bit stuffing
+      std::size_t const num_stuffable_bits {1 + 11 + 1 + 1 + 1 + 4 + 8*data_length + 15};
+      // CRC delimiter, ACK slot and delimiter, end of frame and inter-frame space
+      std::size_t const num_fixed_bits {1 + 2 + 7 + 3};
+      std::size_t const num_stuff_bits {is_worst_case ? (num_stuffable_bits - 1)/4 : 0};
+      return num_stuffable_bits + num_stuff_bits + num_fixed_bits;
+    }
+
+    /**\fn getFrameDuration
+     * \brief
+     *    Get the time a single CAN 2.0A data frame occupies the bus
+     *
+     * \param[in] baud_rate
+     *    The Baud rate setting of the bus
+     * \param[in] data_length
+     *    The number of data bytes of the frame [0, 8]
+     * \param[in] is_worst_case
+     *    Boolean flag signaling whether the worst-case number of stuff bits should be taken into account
+     * \return
+     *    The duration of the frame on the bus
+    */
+    [[nodiscard]]
+    constexpr std::chrono::nanoseconds getFrameDuration(CanBaudRate const baud_rate, std::size_t const data_length = 8,
+                                                        bool const is_worst_case = true) noexcept {
+      auto const num_bits {static_cast<std::int64_t>(getFrameBits(data_length, is_worst_case))};
+      auto const bit_rate {static_cast<std::int64_t>(getBitRate(baud_rate))};
+      return std::chrono::nanoseconds{(num_bits*std::nano::den + bit_rate - 1)/bit_rate};
+    }
+
+  }
+}
+
+#endif // MYACTUATOR_RMD__CAN__BUS_TIMING
@@ -12,10 +12,13 @@
 
 #include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
 
+#include <linux/can.h>
+
 #include "myactuator_rmd/can/frame.hpp"
 
 
@@ -109,6 +112,22 @@ namespace myactuator_rmd {
         [[nodiscard]]
         Frame read() const;
 
+        /**\fn readBatch
+         * \brief
+         *    Read all frames that are pending with a single system call, blocks only until the first frame is
+         *    received. In contrast to read the frames are neither copied nor checked for errors: Error frames
+         *    are returned as is and can be recognised by the CAN_ERR_FLAG of their can_id.
+         * 
+         * \param[out] frames
+         *    The buffer that the frames are received into
+         * \param[in] num_frames
+         *    The maximum number of frames to be received, the size of the buffer
+         * \return
+         *    The number of received frames, at most 64 per call
+        */
+        [[nodiscard]]
+        std::size_t readBatch(struct ::can_frame* frames, std::size_t const num_frames) const;
+
         /**\fn write
          * \brief
          *   Write the given CAN frame
@@ -129,6 +148,27 @@ namespace myactuator_rmd {
         */
         void write(std::uint32_t const can_id, std::array<std::uint8_t,8> const& data);
 
+        /**\fn discardPending
+         * \brief
+         *    Discards all frames that have already been received but not read yet without blocking,
+         *    e.g. replies that arrived only after their read had timed out
+         * 
+         * \return
+         *    The number of discarded frames
+        */
+        std::size_t discardPending() noexcept;
+
+        /**\fn release
+         * \brief
+         *    Hands the ownership of the underlying socket over to the caller, e.g. for integrating it into
+         *    an event loop. The node can not be used for communication afterwards.
+         * 
+         * \return
+         *    The file descriptor of the socket that has to be closed by the caller
+        */
+        [[nodiscard]]
+        int release() noexcept;
+
       protected:
         /**\fn initSocket
          * \brief
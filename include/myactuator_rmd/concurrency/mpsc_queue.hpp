@@ -0,0 +1,163 @@
+/**
+ * \file mpsc_queue.hpp
+ * \mainpage
+ *    Contains an intrusive lock-free multi-producer single-consumer queue
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__CONCURRENCY__MPSC_QUEUE
+#define MYACTUATOR_RMD__CONCURRENCY__MPSC_QUEUE
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+
+namespace myactuator_rmd {
+
+  /**\class MpscNode
+   * \brief
+   *    Base class for all elements that should be enqueued in an MpscQueue
+  */
+  class MpscNode {
+    public:
+      MpscNode() = default;
+      MpscNode(MpscNode const&) = delete;
+      MpscNode& operator = (MpscNode const&) = delete;
+      MpscNode(MpscNode&&) = delete;
+      MpscNode& operator = (MpscNode&&) = delete;
+
+    protected:
+      std::atomic<MpscNode*> next_ {nullptr};
+
+      template <typename T>
+      friend class MpscQueue;
+  };
+
+  /**\class MpscQueue
+   * \brief
+   *    Intrusive unbounded lock-free multi-producer single-consumer queue, see
+   *    https://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+   *    Pushing is wait-free and never allocates, the storage of the nodes is owned by the producers.
+   *    A node must not be destroyed or pushed again before it has been popped by the consumer.
+   *
+   * \tparam T
+   *    Type of the elements, has to be derived from MpscNode
+  */
+  template <typename T>
+  class MpscQueue {
+    static_assert(std::is_base_of_v<MpscNode, T>, "Elements of the queue have to be derived from MpscNode!");
+
+    public:
+      MpscQueue() noexcept;
+      MpscQueue(MpscQueue const&) = delete;
+      MpscQueue& operator = (MpscQueue const&) = delete;
+      MpscQueue(MpscQueue&&) = delete;
+      MpscQueue& operator = (MpscQueue&&) = delete;
+
+      /**\fn push
+       * \brief
+       *    Enqueue the given node, can be called concurrently by any number of threads
+       *
+       * \param[in] node
+       *    The node to be enqueued
+      */
+      void push(T* const node) noexcept;
+
+      /**\fn pop
+       * \brief
+       *    Dequeue the oldest node, must only be called by a single consumer thread
+       * \warning
+       *    Might return a nullptr while a producer is in the middle of pushing a node. Callers that know that
+       *    a node has been pushed (e.g. through a semaphore) should simply retry in this case.
+       *
+       * \return
+       *    The oldest node or a nullptr if the queue is empty
+      */
+      [[nodiscard]]
+      T* pop() noexcept;
+
+      /**\fn isEmpty
+       * \brief
+       *    Check if the queue is currently empty, must only be called by the consumer thread
+       *
+       * \return
+       *    Boolean flag signaling whether there is no element left to be popped
+      */
+      [[nodiscard]]
+      bool isEmpty() const noexcept;
+
+    protected:
+      /**\fn pushNode
+       * \brief
+       *    Enqueue the given node without any type check
+       *
+       * \param[in] node
+       *    The node to be enqueued
+      */
+      void pushNode(MpscNode* const node) noexcept;
+
+      std::atomic<MpscNode*> head_;
+      MpscNode* tail_;
+      MpscNode stub_;
+  };
+
+  template <typename T>
+  MpscQueue<T>::MpscQueue() noexcept
+  : head_{&stub_}, tail_{&stub_}, stub_{} {
+    return;
+  }
+
+  template <typename T>
+  void MpscQueue<T>::push(T* const node) noexcept {
+    pushNode(node);
+    return;
+  }
+
+  template <typename T>
+  T* MpscQueue<T>::pop() noexcept {
+    MpscNode* tail {tail_};
+    MpscNode* next {tail->next_.load(std::memory_order_acquire)};
+    if (tail == &stub_) {
+      if (next == nullptr) {
+        return nullptr;
+      }
+      tail_ = next;
+      tail = next;
+      next = next->next_.load(std::memory_order_acquire);
+    }
+    if (next != nullptr) {
+      tail_ = next;
+      return static_cast<T*>(tail);
+    }
+    // A producer has exchanged the head but not linked its node yet
+    if (tail != head_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    pushNode(&stub_);
+    next = tail->next_.load(std::memory_order_acquire);
+    if (next != nullptr) {
+      tail_ = next;
+      return static_cast<T*>(tail);
+    }
+    return nullptr;
+  }
+
+  template <typename T>
+  bool MpscQueue<T>::isEmpty() const noexcept {
+    return (tail_ == &stub_) && (stub_.next_.load(std::memory_order_acquire) == nullptr) &&
+           (head_.load(std::memory_order_acquire) == &stub_);
+  }
+
+  template <typename T>
+  void MpscQueue<T>::pushNode(MpscNode* const node) noexcept {
+    node->next_.store(nullptr, std::memory_order_relaxed);
+    MpscNode* const previous {head_.exchange(node, std::memory_order_acq_rel)};
+    previous->next_.store(node, std::memory_order_release);
+    return;
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__CONCURRENCY__MPSC_QUEUE
@@ -0,0 +1,404 @@
+/**
+ * \file async_actuator_interface.hpp
+ * \mainpage
+ *    Contains the awaitable interface to a single actuator, requires C++20
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__COROUTINE__ASYNC_ACTUATOR_INTERFACE
+#define MYACTUATOR_RMD__COROUTINE__ASYNC_ACTUATOR_INTERFACE
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "myactuator_rmd/actuator_state/acceleration_type.hpp"
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/actuator_state/control_mode.hpp"
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/gains.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_2.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/coroutine/bus_awaiter.hpp"
+#include "myactuator_rmd/coroutine/scheduler.hpp"
+#include "myactuator_rmd/coroutine/task.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class AsyncActuatorInterface
+   * \brief
+   *    Awaitable interface for commanding the MyActuator RMD actuator series: Each operation suspends the
+   *    calling coroutine until the reply was received by the bus thread of the driver and is then resumed by
+   *    the scheduler. Multi-step sequences for many actuators can therefore run concurrently on a single thread.
+   * \warning
+   *    Tasks only start once they are awaited, the interface therefore has to outlive all tasks created by it
+  */
+  class AsyncActuatorInterface {
+    public:
+      /**\fn AsyncActuatorInterface
+       * \brief
+       *    Class constructor
+       * 
+       * \param[in] driver
+       *    The thread-safe driver whose bus thread performs the communication
+       * \param[in] scheduler
+       *    The scheduler that resumes the awaiting coroutines
+       * \param[in] actuator_id
+       *    The actuator id [1, 32]
+      */
+      AsyncActuatorInterface(ThreadSafeDriver& driver, Scheduler& scheduler, std::uint32_t const actuator_id);
+      AsyncActuatorInterface() = delete;
+      AsyncActuatorInterface(AsyncActuatorInterface const&) = default;
+      AsyncActuatorInterface& operator = (AsyncActuatorInterface const&) = delete;
+      AsyncActuatorInterface(AsyncActuatorInterface&&) = default;
+      AsyncActuatorInterface& operator = (AsyncActuatorInterface&&) = delete;
+
+      /**\fn getAccelerationAsync
+       * \brief
+       *    Reads the current acceleration
+       * 
+       * \return
+       *    The current acceleration in dps with a resolution of 1 dps
+      */
+      Task<std::int32_t> getAccelerationAsync();
+
+      /**\fn getCanIdAsync
+       * \brief
+       *    Get the CAN ID of the device
+       * 
+       * \return
+       *    The CAN ID of the device starting at 0x240
+      */
+      Task<std::uint16_t> getCanIdAsync();
+
+      /**\fn getControllerGainsAsync
+       * \brief
+       *    Reads the currently used controller gains
+       * 
+       * \return
+       *    The currently used controller gains for current, speed and position as unsigned 8-bit integers
+      */
+      Task<Gains> getControllerGainsAsync();
+
+      /**\fn getControlModeAsync
+       * \brief
+       *    Reads the currently used control mode
+       * 
+       * \return
+       *    The currently used control mode
+      */
+      Task<ControlMode> getControlModeAsync();
+
+      /**\fn getMotorModelAsync
+       * \brief
+       *    Reads the motor model currently in use by the actuator
+       * 
+       * \return
+       *    The motor model string currently in use by the actuator, e.g. 'X8S2V10'
+      */
+      Task<std::string> getMotorModelAsync();
+
+      /**\fn getMotorPowerAsync
+       * \brief
+       *    Reads the current motor power consumption in Watt
+       * 
+       * \return
+       *    The current motor power consumption in Watt with a resolution of 0.1
+      */
+      Task<float> getMotorPowerAsync();
+
+      /**\fn getMotorStatus1Async
+       * \brief
+       *    Reads the motor status 1
+       * 
+       * \return
+       *    The motor status 1 containing temperature, voltage and error codes
+      */
+      Task<MotorStatus1> getMotorStatus1Async();
+
+      /**\fn getMotorStatus2Async
+       * \brief
+       *    Reads the motor status 2
+       * 
+       * \return
+       *    The motor status 2 containing current, speed and position
+      */
+      Task<MotorStatus2> getMotorStatus2Async();
+
+      /**\fn getMotorStatus3Async
+       * \brief
+       *    Reads the motor status 3
+       * 
+       * \return
+       *    The motor status 3 containing detailed current information
+      */
+      Task<MotorStatus3> getMotorStatus3Async();
+
+      /**\fn getMultiTurnAngleAsync
+       * \brief
+       *    Read the multi-turn angle
+       * 
+       * \return
+       *    The current multi-turn angle with a resolution of 0.01 deg
+      */
+      Task<float> getMultiTurnAngleAsync();
+
+      /**\fn getMultiTurnEncoderPositionAsync
+       * \brief
+       *    Read the multi-turn encoder position subtracted by the encoder multi-turn zero offset
+       * 
+       * \return
+       *    The multi-turn encoder position
+      */
+      Task<std::int32_t> getMultiTurnEncoderPositionAsync();
+
+      /**\fn getMultiTurnEncoderOriginalPositionAsync
+       * \brief
+       *    Read the raw multi-turn encoder position without taking into consideration the multi-turn zero offset
+       * 
+       * \return
+       *    The multi-turn encoder position
+      */
+      Task<std::int32_t> getMultiTurnEncoderOriginalPositionAsync();
+
+      /**\fn getMultiTurnEncoderZeroOffsetAsync
+       * \brief
+       *    Read the multi-turn encoder zero offset
+       * 
+       * \return
+       *    The multi-turn encoder zero offset
+      */
+      Task<std::int32_t> getMultiTurnEncoderZeroOffsetAsync();
+
+      /**\fn getRuntimeAsync
+       * \brief
+       *    Reads the uptime of the actuator in milliseconds
+       * 
+       * \return
+       *    The uptime of the actuator in milliseconds
+      */
+      Task<std::chrono::milliseconds> getRuntimeAsync();
+
+      /**\fn getSingleTurnAngleAsync
+       * \brief
+       *    Read the single-turn angle
+       * \warning
+       *    This does not seem to give correct values with my X8-PRO V2 actuator!
+       * 
+       * \return
+       *    The current single-turn angle with a resolution of 0.01 deg
+      */
+      Task<float> getSingleTurnAngleAsync();
+
+      /**\fn getSingleTurnEncoderPositionAsync
+       * \brief
+       *    Read the single-turn encoder position
+       * 
+       * \return
+       *    The single-turn encoder position
+      */
+      Task<std::int16_t> getSingleTurnEncoderPositionAsync();
+
+      /**\fn getVersionDateAsync
+       * \brief
+       *    Reads the version date of the actuator firmware
+       * 
+       * \return
+       *    The version date of the firmware on the actuator, e.g. '20220206'
+      */
+      Task<std::uint32_t> getVersionDateAsync();
+
+      /**\fn lockBrakeAsync
+       * \brief
+       *    Close the holding brake. The motor won't be able to turn anymore.
+      */
+      Task<void> lockBrakeAsync();
+
+      /**\fn releaseBrakeAsync
+       * \brief
+       *    Open the holding brake leaving the motor in a movable state
+      */
+      Task<void> releaseBrakeAsync();
+
+      /**\fn resetAsync
+       * \brief
+       *    Reset the actuator
+      */
+      Task<void> resetAsync();
+
+      /**\fn sendCurrentSetpointAsync
+       * \brief
+       *    Send a current set-point to the actuator
+       *
+       * \param[in] current
+       *    The current set-point in Ampere
+       * \return
+       *    Feedback control message containing actuator position, velocity, torque and temperature
+      */
+      Task<Feedback> sendCurrentSetpointAsync(float const current);
+
+      /**\fn sendPositionAbsoluteSetpointAsync
+       * \brief
+       *    Send an absolute position set-point to the actuator additionally specifying a maximum velocity
+       *
+       * \param[in] position
+       *    The position set-point in degree
+       * \param[in] max_speed
+       *    The maximum speed for the motion in degree per second
+       * \return
+       *    Feedback control message containing actuator position, velocity, torque and temperature
+      */
+      Task<Feedback> sendPositionAbsoluteSetpointAsync(float const position, float const max_speed = 500.0);
+
+      /**\fn sendTorqueSetpointAsync
+       * \brief
+       *    Send a torque set-point to the actuator by setting the current
+       *
+       * \param[in] torque
+       *    The desired torque in [Nm]
+       * \param[in] torque_constant
+       *    The motor's torque constant [Nm/A], depends on the model of the motor, refer to actuator_constants.hpp
+       *    for the torque constant of your actuator
+       * \return
+       *    Feedback control message containing actuator position, velocity, torque and temperature
+      */
+      Task<Feedback> sendTorqueSetpointAsync(float const torque, float const torque_constant);
+
+      /**\fn sendVelocitySetpointAsync
+       * \brief
+       *    Send a velocity set-point to the actuator
+       *
+       * \param[in] speed
+       *    The speed set-point in degree per second
+       * \return
+       *    Feedback control message containing actuator position, velocity, torque and temperature
+      */
+      Task<Feedback> sendVelocitySetpointAsync(float const speed);
+
+      /**\fn setAccelerationAsync
+       * \brief
+       *    Write the acceleration/deceleration for the different modes to RAM and ROM (persistent)
+       * 
+       * \param[in] acceleration
+       *    The desired acceleration/deceleration in dps with a resolution of 1 dps/s [100, 60000]
+       *    For continuous motions the acceleration should be set to the value 0, see 
+       *    https://github.com/2b-t/myactuator_rmd/issues/10#issuecomment-2195847459
+       * \param[in] mode
+       *    The mode of the desired acceleration/deceleration to be set
+      */
+      Task<void> setAccelerationAsync(std::uint32_t const acceleration, AccelerationType const mode);
+
+      /**\fn setCanBaudRateAsync
+       * \brief
+       *    Set the communication Baud rate for CAN bus
+       * 
+       * \param[in] baud_rate
+       *    Communication Baud rate that the actuator should operator with
+      */
+      Task<void> setCanBaudRateAsync(CanBaudRate const baud_rate);
+
+      /**\fn setCanIdAsync
+       * \brief
+       *    Set the CAN ID of the device
+       * 
+       * \param[in] can_id
+       *    The CAN ID of the device in the range [1, 32]
+      */
+      Task<void> setCanIdAsync(std::uint16_t const can_id);
+
+      /**\fn setCurrentPositionAsEncoderZeroAsync
+       * \brief
+       *    Set the zero offset (initial position) of the encoder to the current position
+       * \warning
+       *    Motor has be restarted in order for this to become effective
+       * 
+       * \return
+       *    Current encoder position that was set to be zero
+      */
+      Task<std::int32_t> setCurrentPositionAsEncoderZeroAsync();
+
+      /**\fn setEncoderZeroAsync
+       * \brief
+       *    Set the zero offset (initial position) of the encoder to a given value
+       * \warning
+       *    Motor has be restarted in order for this to become effective
+       * 
+       * \param[in] encoder_offset
+       *    Encoder offset that should be set as zero
+      */
+      Task<void> setEncoderZeroAsync(std::int32_t const encoder_offset);
+
+      /**\fn setControllerGainsAsync
+       * \brief
+       *    Write the currently used controller gains either to RAM (not persistent after reboot) or ROM (persistent)
+       * 
+       * \param[in] gains
+       *    The PI-gains for current, speed and position to be set
+       * \param[in] is_persistent
+       *    Boolean argument signaling whether the controller gains should be persistent after reboot of the actuator or not
+       * \return
+       *    The currently used controller gains for current, speed and position as unsigned 8-bit integers
+      */
+      Task<Gains> setControllerGainsAsync(Gains const gains, bool const is_persistent = false);
+
+      /**\fn setTimeoutAsync
+       * \brief
+       *    Set the communication interruption protection time setting. The break will be triggered if the communication
+       *    is interrupted for longer than the set time. The value 0 disables this feature.
+       * 
+       * \param[in] timeout
+       *    The desired interruption protection time, 0 in case it should be disabled
+      */
+      Task<void> setTimeoutAsync(std::chrono::milliseconds const timeout);
+
+      /**\fn shutdownMotorAsync
+       * \brief
+       *    Turn off the motor
+      */
+      Task<void> shutdownMotorAsync();
+
+      /**\fn stopMotorAsync
+       * \brief
+       *    Stop the motor if running closed loop command
+      */
+      Task<void> stopMotorAsync();
+
+    protected:
+      /**\fn send
+       * \brief
+       *    Creates an awaitable request that only sends the message
+       * 
+       * \param[in] msg
+       *    The message that should be sent to the actuator
+       * \return
+       *    The awaitable request
+      */
+      [[nodiscard]]
+      BusAwaiter send(Message const& msg);
+
+      /**\fn sendRecv
+       * \brief
+       *    Creates an awaitable request that sends the message and receives the reply
+       * 
+       * \param[in] request
+       *    The request that should be sent to the actuator
+       * \return
+       *    The awaitable request resulting in the response bytes
+      */
+      [[nodiscard]]
+      BusAwaiter sendRecv(Message const& request);
+
+      ThreadSafeDriver& driver_;
+      Scheduler& scheduler_;
+      std::uint32_t actuator_id_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__COROUTINE__ASYNC_ACTUATOR_INTERFACE
@@ -0,0 +1,102 @@
+/**
+ * \file bus_awaiter.hpp
+ * \mainpage
+ *    Contains an awaitable request to a thread-safe driver, requires C++20
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__COROUTINE__BUS_AWAITER
+#define MYACTUATOR_RMD__COROUTINE__BUS_AWAITER
+#pragma once
+
+#include <array>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+
+#include "myactuator_rmd/coroutine/scheduler.hpp"
+#include "myactuator_rmd/driver/request_priority.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class BusAwaiter
+   * \brief
+   *    Request that suspends the awaiting coroutine instead of blocking its thread. The request is handed over
+   *    to the bus thread of the driver which posts the coroutine to the scheduler once the reply was received.
+  */
+  class BusAwaiter: public ThreadSafeDriver::BusRequest {
+    public:
+      /**\fn BusAwaiter
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] driver
+       *    The driver whose bus thread should process the request
+       * \param[in] scheduler
+       *    The scheduler that should resume the awaiting coroutine
+       * \param[in] type_
+       *    The operation that should be performed
+       * \param[in] actuator_id_
+       *    The ID of the actuator that the message should be sent to
+       * \param[in] message_
+       *    The message that should be sent
+      */
+      BusAwaiter(ThreadSafeDriver& driver, Scheduler& scheduler, ThreadSafeDriver::RequestType const type_,
+                 std::uint32_t const actuator_id_, Message const& message_)
+      : BusRequest{type_, actuator_id_, message_, getRequestPriority(static_cast<CommandType>(message_.getData()[0]))},
+        driver_{driver}, scheduler_{scheduler}, handle_{} {
+        on_completion = &BusAwaiter::resume;
+        return;
+      }
+      BusAwaiter() = delete;
+      BusAwaiter(BusAwaiter const&) = delete;
+      BusAwaiter& operator = (BusAwaiter const&) = delete;
+      BusAwaiter(BusAwaiter&&) = delete;
+      BusAwaiter& operator = (BusAwaiter&&) = delete;
+      ~BusAwaiter() = default;
+
+      [[nodiscard]]
+      bool await_ready() const noexcept {
+        return false;
+      }
+
+      void await_suspend(std::coroutine_handle<> const handle) {
+        handle_ = handle;
+        driver_.enqueue(*this);
+        return;
+      }
+
+      std::array<std::uint8_t,8> await_resume() const {
+        if (exception) {
+          std::rethrow_exception(exception);
+        }
+        return response;
+      }
+
+    protected:
+      /**\fn resume
+       * \brief
+       *    Called by the bus thread once the request was processed
+       *
+       * \param[in] request
+       *    The processed request
+      */
+      static void resume(BusRequest& request) noexcept {
+        auto& awaiter {static_cast<BusAwaiter&>(request)};
+        awaiter.scheduler_.post(awaiter.handle_);
+        return;
+      }
+
+      ThreadSafeDriver& driver_;
+      Scheduler& scheduler_;
+      std::coroutine_handle<> handle_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__COROUTINE__BUS_AWAITER
@@ -0,0 +1,161 @@
+/**
+ * \file scheduler.hpp
+ * \mainpage
+ *    Contains a single-threaded scheduler for running coroutines concurrently, requires C++20
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__COROUTINE__SCHEDULER
+#define MYACTUATOR_RMD__COROUTINE__SCHEDULER
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+#include <semaphore.h>
+
+#include "myactuator_rmd/coroutine/task.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class Scheduler
+   * \brief
+   *    Runs coroutines concurrently on the thread calling run(). Coroutines waiting for a reply are resumed
+   *    by it as soon as their reply has been received, so that many actuators can be commanded from a
+   *    single thread without blocking on each other.
+  */
+  class Scheduler {
+    public:
+      /**\fn Scheduler
+       * \brief
+       *    Class constructor
+       *
+       * \throws std::system_error
+       *    If the semaphore could not be initialised
+      */
+      Scheduler();
+      Scheduler(Scheduler const&) = delete;
+      Scheduler& operator = (Scheduler const&) = delete;
+      Scheduler(Scheduler&&) = delete;
+      Scheduler& operator = (Scheduler&&) = delete;
+      ~Scheduler();
+
+      /**\fn spawn
+       * \brief
+       *    Takes ownership of the task and starts it once run() is called
+       *
+       * \param[in] task
+       *    The task that should be run
+      */
+      void spawn(Task<void> task);
+
+      /**\fn post
+       * \brief
+       *    Resumes the coroutine from inside run(), can be called from any thread
+       *
+       * \param[in] handle
+       *    The coroutine that should be resumed
+      */
+      void post(std::coroutine_handle<> const handle);
+
+      /**\fn run
+       * \brief
+       *    Runs the spawned tasks until all of them have finished
+       *
+       * \throws
+       *    The first exception that was not handled by any of the tasks
+      */
+      void run();
+
+    protected:
+      /**\class ScheduleAwaiter
+       * \brief
+       *    Suspends the awaiting coroutine and resumes it from inside run()
+      */
+      class ScheduleAwaiter {
+        public:
+          [[nodiscard]]
+          bool await_ready() const noexcept {
+            return false;
+          }
+
+          void await_suspend(std::coroutine_handle<> const handle) {
+            scheduler.post(handle);
+            return;
+          }
+
+          void await_resume() const noexcept {
+            return;
+          }
+
+          Scheduler& scheduler;
+      };
+
+      /**\class DetachedTask
+       * \brief
+       *    Coroutine owning its own frame that runs a spawned task
+      */
+      class DetachedTask {
+        public:
+          class promise_type {
+            public:
+              [[nodiscard]]
+              DetachedTask get_return_object() const noexcept {
+                return {};
+              }
+
+              [[nodiscard]]
+              std::suspend_never initial_suspend() const noexcept {
+                return {};
+              }
+
+              [[nodiscard]]
+              std::suspend_never final_suspend() const noexcept {
+                return {};
+              }
+
+              void return_void() const noexcept {
+                return;
+              }
+
+              void unhandled_exception() const noexcept {
+                std::terminate();
+              }
+          };
+      };
+
+      /**\fn start
+       * \brief
+       *    Runs a spawned task from inside run() and signals its end
+       *
+       * \param[in] task
+       *    The task that should be run
+       * \return
+       *    The coroutine running the task
+      */
+      DetachedTask start(Task<void> task);
+
+      /**\fn finish
+       * \brief
+       *    Signals that a spawned task has finished
+       *
+       * \param[in] exception
+       *    The exception the task has finished with if any
+      */
+      void finish(std::exception_ptr const& exception) noexcept;
+
+      std::mutex mutex_;
+      ::sem_t num_events_; // Posted for every coroutine that becomes ready and every task that finishes
+      std::deque<std::coroutine_handle<>> ready_;
+      std::size_t num_active_;
+      std::exception_ptr exception_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__COROUTINE__SCHEDULER
@@ -0,0 +1,262 @@
+/**
+ * \file task.hpp
+ * \mainpage
+ *    Contains a lazily started coroutine returning a value, requires C++20
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__COROUTINE__TASK
+#define MYACTUATOR_RMD__COROUTINE__TASK
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+
+namespace myactuator_rmd {
+
+  template <typename T>
+  class Task;
+
+  namespace detail {
+
+    /**\class TaskPromiseBase
+     * \brief
+     *    Part of the promise of a task that is independent of its return type
+    */
+    class TaskPromiseBase {
+      public:
+        /**\class FinalAwaiter
+         * \brief
+         *    Resumes the coroutine awaiting the finished task
+        */
+        class FinalAwaiter {
+          public:
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+              return false;
+            }
+
+            template <typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+              auto const continuation {handle.promise().continuation};
+              if (continuation) {
+                return continuation;
+              }
+              return std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept {
+              return;
+            }
+        };
+
+        [[nodiscard]]
+        std::suspend_always initial_suspend() const noexcept {
+          return {};
+        }
+
+        [[nodiscard]]
+        FinalAwaiter final_suspend() const noexcept {
+          return {};
+        }
+
+        void unhandled_exception() noexcept {
+          exception = std::current_exception();
+          return;
+        }
+
+        std::coroutine_handle<> continuation {};
+        std::exception_ptr exception {};
+    };
+
+  }
+
+  /**\class Task
+   * \brief
+   *    Coroutine that is started once it is awaited and resumes its awaiting coroutine when it finishes
+   *
+   * \tparam T
+   *    The type of the value returned by the coroutine
+  */
+  template <typename T>
+  class [[nodiscard]] Task {
+    public:
+      /**\class promise_type
+       * \brief
+       *    Stores the result of the coroutine
+      */
+      class promise_type: public detail::TaskPromiseBase {
+        public:
+          [[nodiscard]]
+          Task get_return_object() noexcept {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+          }
+
+          template <typename U>
+          void return_value(U&& value) {
+            result.emplace(std::forward<U>(value));
+            return;
+          }
+
+          std::optional<T> result {};
+      };
+
+      Task() = delete;
+      Task(Task const&) = delete;
+      Task& operator = (Task const&) = delete;
+      Task(Task&& other) noexcept
+      : handle_{std::exchange(other.handle_, nullptr)} {
+        return;
+      }
+      Task& operator = (Task&& other) noexcept {
+        if (this != &other) {
+          destroy();
+          handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+      }
+      ~Task() {
+        destroy();
+        return;
+      }
+
+      [[nodiscard]]
+      bool await_ready() const noexcept {
+        return false;
+      }
+
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+        handle_.promise().continuation = continuation;
+        return handle_;
+      }
+
+      T await_resume() {
+        auto& promise {handle_.promise()};
+        if (promise.exception) {
+          std::rethrow_exception(promise.exception);
+        }
+        return std::move(*promise.result);
+      }
+
+    protected:
+      /**\fn Task
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] handle
+       *    The handle of the coroutine that is owned by the task
+      */
+      explicit Task(std::coroutine_handle<promise_type> const handle) noexcept
+      : handle_{handle} {
+        return;
+      }
+
+      /**\fn destroy
+       * \brief
+       *    Destroys the coroutine frame if owned
+      */
+      void destroy() noexcept {
+        if (handle_) {
+          handle_.destroy();
+          handle_ = nullptr;
+        }
+        return;
+      }
+
+      std::coroutine_handle<promise_type> handle_;
+  };
+
+  /**\class Task
+   * \brief
+   *    Coroutine that is started once it is awaited and resumes its awaiting coroutine when it finishes
+  */
+  template <>
+  class [[nodiscard]] Task<void> {
+    public:
+      /**\class promise_type
+       * \brief
+       *    Stores a possible exception of the coroutine
+      */
+      class promise_type: public detail::TaskPromiseBase {
+        public:
+          [[nodiscard]]
+          Task get_return_object() noexcept {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+          }
+
+          void return_void() const noexcept {
+            return;
+          }
+      };
+
+      Task() = delete;
+      Task(Task const&) = delete;
+      Task& operator = (Task const&) = delete;
+      Task(Task&& other) noexcept
+      : handle_{std::exchange(other.handle_, nullptr)} {
+        return;
+      }
+      Task& operator = (Task&& other) noexcept {
+        if (this != &other) {
+          destroy();
+          handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+      }
+      ~Task() {
+        destroy();
+        return;
+      }
+
+      [[nodiscard]]
+      bool await_ready() const noexcept {
+        return false;
+      }
+
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+        handle_.promise().continuation = continuation;
+        return handle_;
+      }
+
+      void await_resume() {
+        if (handle_.promise().exception) {
+          std::rethrow_exception(handle_.promise().exception);
+        }
+        return;
+      }
+
+    protected:
+      /**\fn Task
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] handle
+       *    The handle of the coroutine that is owned by the task
+      */
+      explicit Task(std::coroutine_handle<promise_type> const handle) noexcept
+      : handle_{handle} {
+        return;
+      }
+
+      /**\fn destroy
+       * \brief
+       *    Destroys the coroutine frame if owned
+      */
+      void destroy() noexcept {
+        if (handle_) {
+          handle_.destroy();
+          handle_ = nullptr;
+        }
+        return;
+      }
+
+      std::coroutine_handle<promise_type> handle_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__COROUTINE__TASK
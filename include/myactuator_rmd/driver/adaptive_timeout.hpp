@@ -0,0 +1,161 @@
+/**
+ * \file adaptive_timeout.hpp
+ * \mainpage
+ *    Contains a policy for deriving receive timeouts from the observed round-trip times
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__DRIVER__ADAPTIVE_TIMEOUT
+#define MYACTUATOR_RMD__DRIVER__ADAPTIVE_TIMEOUT
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <utility>
+
+#include "myactuator_rmd/telemetry/quantile_sketch.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class AdaptiveTimeout
+   * \brief
+   *    Tracks the round-trip time per actuator and command in a streaming quantile sketch and derives the receive
+   *    timeout from it as a high quantile times a safety factor, clamped to a floor and a ceiling. Until enough
+   *    round trips have been observed the ceiling is used. Timeouts are fed back as samples so that a timeout
+   *    that turns out to be too tight grows again.
+  */
+  class AdaptiveTimeout {
+    public:
+      /**\fn AdaptiveTimeout
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] factor
+       *    The safety factor the quantile is multiplied with, has to be at least one
+       * \param[in] floor
+       *    The smallest timeout that should ever be used
+       * \param[in] ceiling
+       *    The largest timeout that should ever be used, also used until enough samples are available
+       * \param[in] quantile
+       *    The quantile of the round-trip times the timeout is based on ]0, 1]
+       * \param[in] min_samples
+       *    The number of round trips that have to be observed before the timeout adapts
+       * \param[in] window
+       *    The number of samples after which old samples start to be faded out
+      */
+      AdaptiveTimeout(double const factor = 3.0, std::chrono::microseconds const& floor = std::chrono::microseconds(200),
+                      std::chrono::microseconds const& ceiling = std::chrono::seconds(1), double const quantile = 0.999,
+                      std::uint64_t const min_samples = 1000, std::uint64_t const window = 10000);
+      AdaptiveTimeout(AdaptiveTimeout const&) = default;
+      AdaptiveTimeout& operator = (AdaptiveTimeout const&) = default;
+      AdaptiveTimeout(AdaptiveTimeout&&) = default;
+      AdaptiveTimeout& operator = (AdaptiveTimeout&&) = default;
+
+      /**\fn getTimeout
+       * \brief
+       *    Get the receive timeout that should be used for the given request
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator the request is sent to
+       * \param[in] command
+       *    The command byte of the request
+       * \return
+       *    The receive timeout
+      */
+      [[nodiscard]]
+      std::chrono::microseconds getTimeout(std::uint32_t const actuator_id, std::uint8_t const command) const noexcept;
+
+      /**\fn getRoundTripTime
+       * \brief
+       *    Get the estimated quantile of the round-trip time for the given request
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator the request is sent to
+       * \param[in] command
+       *    The command byte of the request
+       * \return
+       *    The round-trip time quantile if any round trip was observed for this request
+      */
+      [[nodiscard]]
+      std::optional<std::chrono::nanoseconds> getRoundTripTime(std::uint32_t const actuator_id, std::uint8_t const command) const noexcept;
+
+      /**\fn addRoundTrip
+       * \brief
+       *    Adds a round-trip time that was measured for the given request
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator the request was sent to
+       * \param[in] command
+       *    The command byte of the request
+       * \param[in] round_trip_time
+       *    The time between sending the request and receiving its reply
+      */
+      void addRoundTrip(std::uint32_t const actuator_id, std::uint8_t const command,
+                        std::chrono::nanoseconds const& round_trip_time);
+
+      /**\fn addTimeout
+       * \brief
+       *    Signals that no reply was received for the given request within the current timeout
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator the request was sent to
+       * \param[in] command
+       *    The command byte of the request
+      */
+      void addTimeout(std::uint32_t const actuator_id, std::uint8_t const command);
+
+    protected:
+      /**\class Entry
+       * \brief
+       *    The round-trip statistics of a single request type to a single actuator
+      */
+      class Entry {
+        public:
+          QuantileSketch sketch;
+          std::chrono::microseconds timeout;
+          std::uint64_t num_pending_samples;
+      };
+
+      /**\fn getEntry
+       * \brief
+       *    Get the entry for the given request, creating it if required
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator the request was sent to
+       * \param[in] command
+       *    The command byte of the request
+       * \return
+       *    The corresponding entry
+      */
+      [[nodiscard]]
+      Entry& getEntry(std::uint32_t const actuator_id, std::uint8_t const command);
+
+      /**\fn update
+       * \brief
+       *    Adds a sample to the entry and updates its timeout if required
+       *
+       * \param[in] entry
+       *    The entry to be updated
+       * \param[in] sample
+       *    The sample to be added
+       * \param[in] is_forced
+       *    Boolean flag signaling whether the timeout should be recomputed immediately
+      */
+      void update(Entry& entry, std::chrono::nanoseconds const& sample, bool const is_forced);
+
+      double factor_;
+      std::chrono::microseconds floor_;
+      std::chrono::microseconds ceiling_;
+      double quantile_;
+      std::uint64_t min_samples_;
+      std::uint64_t window_;
+      std::map<std::pair<std::uint32_t,std::uint8_t>,Entry> entries_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__DRIVER__ADAPTIVE_TIMEOUT
@@ -0,0 +1,170 @@
+/**
+ * \file bus_planner.hpp
+ * \mainpage
+ *    Contains a planner predicting the bus load and achievable loop rate of a given request mix
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__DRIVER__BUS_PLANNER
+#define MYACTUATOR_RMD__DRIVER__BUS_PLANNER
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class PlannedRequest
+   * \brief
+   *    A request that is sent to an actuator periodically as part of a control cycle
+  */
+  class PlannedRequest {
+    public:
+      /**\fn PlannedRequest
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] actuator_id_
+       *    The id of the actuator the request is sent to [1, 32]
+       * \param[in] command_
+       *    The command that is sent, e.g. CommandType::TORQUE_CLOSED_LOOP_CONTROL
+       * \param[in] divider_
+       *    The request is only sent every divider-th cycle, one for every cycle
+      */
+      constexpr PlannedRequest(std::uint32_t const actuator_id_, CommandType const command_, std::uint32_t const divider_ = 1) noexcept;
+      PlannedRequest() = delete;
+      PlannedRequest(PlannedRequest const&) = default;
+      PlannedRequest& operator = (PlannedRequest const&) = default;
+      PlannedRequest(PlannedRequest&&) = default;
+      PlannedRequest& operator = (PlannedRequest&&) = default;
+
+      std::uint32_t actuator_id;
+      CommandType command;
+      std::uint32_t divider;
+  };
+
+  constexpr PlannedRequest::PlannedRequest(std::uint32_t const actuator_id_, CommandType const command_, std::uint32_t const divider_) noexcept
+  : actuator_id{actuator_id_}, command{command_}, divider{divider_} {
+    return;
+  }
+
+  /**\class BusPlan
+   * \brief
+   *    The predicted timing of a control cycle
+  */
+  class BusPlan {
+    public:
+      /**\fn getUtilisation
+       * \brief
+       *    Get the share of the bus time occupied by frames when running the cycle at a given rate
+       *
+       * \param[in] loop_rate
+       *    The rate of the control loop in Hz
+       * \return
+       *    The average bus utilisation, values above one can not be achieved
+      */
+      [[nodiscard]]
+      double getUtilisation(double const loop_rate) const noexcept;
+
+      /**\fn isFeasible
+       * \brief
+       *    Check whether every cycle including the one where all requests coincide fits into a given loop rate
+       *
+       * \param[in] loop_rate
+       *    The rate of the control loop in Hz
+       * \return
+       *    Boolean flag signaling whether the loop rate can be achieved
+      */
+      [[nodiscard]]
+      bool isFeasible(double const loop_rate) const noexcept;
+
+      std::chrono::nanoseconds worst_case_cycle_time; // Duration of the cycle in which all requests are sent
+      std::chrono::nanoseconds average_cycle_time; // Duration of a cycle averaged over all dividers
+      std::chrono::nanoseconds worst_case_bus_time; // Time frames occupy the bus in the worst-case cycle
+      std::chrono::nanoseconds average_bus_time; // Time frames occupy the bus in an average cycle
+      double max_loop_rate; // The maximum loop rate in Hz
+  };
+
+  /**\class BusPlanner
+   * \brief
+   *    Predicts bus utilisation, cycle time and the maximum loop rate for a mix of requests sent each cycle.
+   *    Each request is answered by a reply before the next request is sent, which is how the drivers of
+   *    this library communicate. A round trip therefore consists of the request frame with worst-case bit
+   *    stuffing, the turnaround of the actuator, the reply frame and the overhead of the host.
+  */
+  class BusPlanner {
+    public:
+      /**\fn BusPlanner
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] baud_rate
+       *    The Baud rate of the bus
+       * \param[in] turnaround
+       *    The default time the actuator takes between receiving a request and starting to send its reply
+       * \param[in] host_overhead
+       *    The time the host takes for sending a request and receiving a reply excluding the bus time
+      */
+      BusPlanner(CanBaudRate const baud_rate = CanBaudRate::MBPS1,
+                 std::chrono::nanoseconds const& turnaround = std::chrono::microseconds(100),
+                 std::chrono::nanoseconds const& host_overhead = std::chrono::microseconds(20));
+      BusPlanner(BusPlanner const&) = default;
+      BusPlanner& operator = (BusPlanner const&) = default;
+      BusPlanner(BusPlanner&&) = default;
+      BusPlanner& operator = (BusPlanner&&) = default;
+
+      /**\fn setTurnaround
+       * \brief
+       *    Set the turnaround of a particular command, e.g. from measured round-trip times
+       *
+       * \param[in] command
+       *    The command whose turnaround should be set
+       * \param[in] turnaround
+       *    The time the actuator takes between receiving the request and starting to send its reply
+      */
+      void setTurnaround(CommandType const command, std::chrono::nanoseconds const& turnaround);
+
+      /**\fn getRoundTripTime
+       * \brief
+       *    Get the predicted worst-case time a single request and its reply take
+       *
+       * \param[in] command
+       *    The command that is sent
+       * \return
+       *    The duration of the round trip
+      */
+      [[nodiscard]]
+      std::chrono::nanoseconds getRoundTripTime(CommandType const command) const noexcept;
+
+      /**\fn plan
+       * \brief
+       *    Predict the timing of a control cycle consisting of the given requests
+       *
+       * \param[in] requests
+       *    The requests sent as part of the control cycle
+       * \return
+       *    The predicted timing of the cycle
+       * \throws
+       *    ValueRangeException for invalid actuator ids or dividers and for actuators that are sent more than
+       *    one set-point per cycle, as all requests coincide in the first cycle regardless of their dividers
+      */
+      [[nodiscard]]
+      BusPlan plan(std::vector<PlannedRequest> const& requests) const;
+
+    protected:
+      CanBaudRate baud_rate_;
+      std::chrono::nanoseconds turnaround_;
+      std::chrono::nanoseconds host_overhead_;
+      std::map<CommandType,std::chrono::nanoseconds> turnarounds_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__DRIVER__BUS_PLANNER
@@ -18,13 +18,11 @@
 
 namespace myactuator_rmd {
 
-  class ActuatorInterface;
-
   /**\class CanDriver
    * \brief
    *    CAN driver for commanding several MyActuator RMD actuators
   */
-  class CanDriver: public CanNode<CanAddressOffset::request,CanAddressOffset::response> {
+  class CanDriver final: public CanNode<CanAddressOffset::request,CanAddressOffset::response> {
     public:
       /**\fn CanDriver
        * \brief
@@ -43,8 +41,6 @@ namespace myactuator_rmd {
       CanDriver& operator = (CanDriver const&) = default;
       CanDriver(CanDriver&&) = default;
       CanDriver& operator = (CanDriver&&) = default;
-
-      friend ActuatorInterface;
   };
 
 }
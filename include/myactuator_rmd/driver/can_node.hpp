@@ -11,14 +11,24 @@
 #pragma once
 
 #include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <system_error>
 #include <vector>
 
+#include <linux/can.h>
+
+#include "myactuator_rmd/can/exceptions.hpp"
 #include "myactuator_rmd/can/frame.hpp"
 #include "myactuator_rmd/can/node.hpp"
+#include "myactuator_rmd/driver/adaptive_timeout.hpp"
 #include "myactuator_rmd/driver/driver.hpp"
 #include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/telemetry/feedback_batch.hpp"
 #include "myactuator_rmd/exceptions.hpp"
 
 
@@ -30,20 +40,26 @@ namespace myactuator_rmd {
   */
   template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
   class CanNode: public Driver, protected can::Node {
-    protected:
-      /**\fn CanNode
+    public:
+      /**\fn setAdaptiveTimeout
        * \brief
-       *    Class constructor
+       *    Derive the receive timeout of each request from the round-trip times observed so far instead of
+       *    using a fixed timeout
        * 
-       * \param[in] ifname
-       *    The name of the network interface that should communicated over
+       * \param[in] adaptive_timeout
+       *    The policy used for deriving the receive timeouts
       */
-      CanNode(std::string const& ifname);
-      CanNode() = delete;
-      CanNode(CanNode const&) = delete;
-      CanNode& operator = (CanNode const&) = default;
-      CanNode(CanNode&&) = default;
-      CanNode& operator = (CanNode&&) = default;
+      void setAdaptiveTimeout(AdaptiveTimeout const& adaptive_timeout);
+
+      /**\fn getAdaptiveTimeout
+       * \brief
+       *    Get the policy used for deriving the receive timeouts including the observed round-trip times
+       * 
+       * \return
+       *    The adaptive timeout policy if one was set
+      */
+      [[nodiscard]]
+      std::optional<AdaptiveTimeout> const& getAdaptiveTimeout() const noexcept;
 
       /**\fn addId
        * \brief
@@ -81,6 +97,37 @@ namespace myactuator_rmd {
       [[nodiscard]]
       inline std::array<std::uint8_t,8> sendRecv(Message const& request, std::uint32_t const actuator_id) override;
 
+      /**\fn receiveFeedback
+       * \brief
+       *    Receives the pending replies of several actuators with as few system calls as possible and stores their
+       *    feedback in the batch, e.g. after sending set-points to all actuators with send. Returns once all slots
+       *    of the batch are valid or the timeout has passed, invalidate the batch beforehand.
+       * 
+       * \param[in,out] batch
+       *    The batch that the feedback of the actuators is stored in
+       * \param[in] timeout
+       *    The time to wait for the replies of all actuators in the batch, as they reply one after another it
+       *    has to cover the round-trip times of all of them
+       * \return
+       *    The number of feedback responses stored in the batch
+      */
+      std::size_t receiveFeedback(FeedbackBatch& batch, std::chrono::microseconds const& timeout);
+
+    protected:
+      /**\fn CanNode
+       * \brief
+       *    Class constructor
+       * 
+       * \param[in] ifname
+       *    The name of the network interface that should communicated over
+      */
+      CanNode(std::string const& ifname);
+      CanNode() = delete;
+      CanNode(CanNode const&) = delete;
+      CanNode& operator = (CanNode const&) = default;
+      CanNode(CanNode&&) = default;
+      CanNode& operator = (CanNode&&) = default;
+
     protected:
       /**\fn getCanSendId
        * \brief
@@ -106,15 +153,55 @@ namespace myactuator_rmd {
       [[nodiscard]]
       constexpr std::uint32_t getCanReceiveId(std::uint32_t const actuator_id) noexcept;
 
+      /**\fn updateRecvTimeout
+       * \brief
+       *    Sets the receive timeout of the socket unless it is set to the given timeout already
+       * 
+       * \param[in] timeout
+       *    The timeout for receiving frames
+      */
+      void updateRecvTimeout(std::chrono::microseconds const& timeout);
+
+      /**\fn readResponse
+       * \brief
+       *    Reads frames until the response of the given actuator to the given command is received, skipping
+       *    replies of other actuators sharing the socket as well as stale replies to previous requests
+       * 
+       * \param[in] actuator_id
+       *    The ID of the actuator that the response is expected from
+       * \param[in] command
+       *    The command byte of the request that the response is expected for
+       * \return
+       *    The response bytes
+      */
+      [[nodiscard]]
+      std::array<std::uint8_t,8> readResponse(std::uint32_t const actuator_id, std::uint8_t const command);
+
       std::vector<std::uint32_t> actuator_ids_;
+      std::optional<AdaptiveTimeout> adaptive_timeout_;
+      std::chrono::microseconds default_receive_timeout_;
+      std::chrono::microseconds receive_timeout_;
+      bool is_reply_pending_;
   };
 
   template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
   CanNode<SEND_ID_OFFSET,RECEIVE_ID_OFFSET>::CanNode(std::string const& ifname)
-  : can::Node{ifname}, Driver{} {
+  : can::Node{ifname}, Driver{}, actuator_ids_{}, adaptive_timeout_{}, default_receive_timeout_{std::chrono::seconds(1)},
+    receive_timeout_{default_receive_timeout_}, is_reply_pending_{false} {
     return;
   }
 
+  template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
+  void CanNode<SEND_ID_OFFSET,RECEIVE_ID_OFFSET>::setAdaptiveTimeout(AdaptiveTimeout const& adaptive_timeout) {
+    adaptive_timeout_ = adaptive_timeout;
+    return;
+  }
+
+  template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
+  std::optional<AdaptiveTimeout> const& CanNode<SEND_ID_OFFSET,RECEIVE_ID_OFFSET>::getAdaptiveTimeout() const noexcept {
+    return adaptive_timeout_;
+  }
+
   template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
   void CanNode<SEND_ID_OFFSET,RECEIVE_ID_OFFSET>::addId(std::uint32_t const actuator_id) {
     if ((actuator_id < 1) || (actuator_id > 32)) {
@@ -139,9 +226,101 @@ namespace myactuator_rmd {
   template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
   std::array<std::uint8_t,8> CanNode<SEND_ID_OFFSET,RECEIVE_ID_OFFSET>::sendRecv(Message const& request, std::uint32_t const actuator_id) {
     auto const can_send_id {getCanSendId(actuator_id)};
+    if (!adaptive_timeout_) {
+      // The timeout might have been changed when receiving the feedback of several actuators
+      updateRecvTimeout(default_receive_timeout_);
+      write(can_send_id, request.getData());
+      return readResponse(actuator_id, request.getData()[0]);
+    }
+
+    auto const command {request.getData()[0]};
+    updateRecvTimeout(adaptive_timeout_->getTimeout(actuator_id, command));
+    if (is_reply_pending_) {
+      // A reply that arrives after its read timed out would otherwise be mistaken for the reply to this request
+      static_cast<void>(discardPending());
+      is_reply_pending_ = false;
+    }
+    auto const start {std::chrono::steady_clock::now()};
     write(can_send_id, request.getData());
-    can::Frame const frame {can::Node::read()};
-    return frame.getData();
+    try {
+      auto const response {readResponse(actuator_id, command)};
+      adaptive_timeout_->addRoundTrip(actuator_id, command, std::chrono::steady_clock::now() - start);
+      return response;
+    } catch (can::SocketException const& e) {
+      if ((e.code().value() == EAGAIN) || (e.code().value() == EWOULDBLOCK)) {
+        adaptive_timeout_->addTimeout(actuator_id, command);
+        is_reply_pending_ = true;
+      }
+      throw;
+    }
+  }
+
+  template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
+  std::size_t CanNode<SEND_ID_OFFSET,RECEIVE_ID_OFFSET>::receiveFeedback(FeedbackBatch& batch,
+                                                                          std::chrono::microseconds const& timeout) {
+    constexpr std::size_t max_num_frames {64};
+    std::array<struct ::can_frame,max_num_frames> frames {};
+    std::size_t num_updated {0};
+    // The timeout of the last request would only cover the reply of a single actuator
+    updateRecvTimeout(timeout);
+    auto const deadline {std::chrono::steady_clock::now() + timeout};
+    while (!batch.isComplete()) {
+      std::size_t num_received {0};
+      try {
+        num_received = readBatch(frames.data(), frames.size());
+      } catch (can::SocketException const& e) {
+        // Actuators that did not reply in time are left invalid
+        if ((e.code().value() == EAGAIN) || (e.code().value() == EWOULDBLOCK)) {
+          break;
+        }
+        throw;
+      }
+      auto const timestamp {std::chrono::steady_clock::now()};
+      for (std::size_t i = 0; i < num_received; ++i) {
+        auto const& frame {frames[i]};
+        if ((frame.can_id & CAN_ERR_FLAG) || (frame.can_id < RECEIVE_ID_OFFSET)) {
+          continue;
+        }
+        if (batch.update(frame.can_id - RECEIVE_ID_OFFSET, frame.data, timestamp)) {
+          ++num_updated;
+        }
+      }
+      // Wait only for the remainder of the timeout for the replies that are still missing
+      auto const remaining {std::chrono::duration_cast<std::chrono::microseconds>(deadline - timestamp)};
+      if (batch.isComplete() || (remaining <= std::chrono::microseconds::zero())) {
+        break;
+      }
+      updateRecvTimeout(remaining);
+    }
+    return num_updated;
+  }
+
+  template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
+  void CanNode<SEND_ID_OFFSET,RECEIVE_ID_OFFSET>::updateRecvTimeout(std::chrono::microseconds const& timeout) {
+    if (timeout != receive_timeout_) {
+      setRecvTimeout(timeout);
+      receive_timeout_ = timeout;
+    }
+    return;
+  }
+
+  template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
+  std::array<std::uint8_t,8> CanNode<SEND_ID_OFFSET,RECEIVE_ID_OFFSET>::readResponse(std::uint32_t const actuator_id,
+                                                                                      std::uint8_t const command) {
+    auto const can_receive_id {getCanReceiveId(actuator_id)};
+    auto const deadline {std::chrono::steady_clock::now() + receive_timeout_};
+    while (true) {
+      can::Frame const frame {can::Node::read()};
+      // Compared directly instead of decoding as the frame might belong to any command
+      if ((frame.getId() == can_receive_id) && (frame.getData()[0] == command)) {
+        return frame.getData();
+      }
+      // Steady traffic of other actuators would otherwise restart the socket timeout indefinitely
+      if (std::chrono::steady_clock::now() >= deadline) {
+        throw can::SocketException(EAGAIN, std::generic_category(), "Timed out waiting for response of actuator '" +
+                                   std::to_string(actuator_id) + "'");
+      }
+    }
   }
 
   template <std::uint32_t SEND_ID_OFFSET, std::uint32_t RECEIVE_ID_OFFSET>
@@ -0,0 +1,157 @@
+/**
+ * \file coalescing_driver.hpp
+ * \mainpage
+ *    Contains a driver that merges identical read requests issued at the same time
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__DRIVER__COALESCING_DRIVER
+#define MYACTUATOR_RMD__DRIVER__COALESCING_DRIVER
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class CoalescingDriver
+   * \brief
+   *    Driver that performs single-flight coalescing of identical read requests: If an identical read for the
+   *    same actuator is already in flight or has completed within a freshness window, the caller receives the
+   *    same response without another frame being sent over the bus. Any request that alters the actuator
+   *    invalidates the cached responses of that actuator.
+   *    Multiple threads can only call it concurrently if the underlying driver is thread-safe as well
+   *    (e.g. a ThreadSafeDriver).
+  */
+  class CoalescingDriver: public Driver {
+    public:
+      /**\fn CoalescingDriver
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] driver
+       *    The driver communicating with the actuators
+       * \param[in] freshness
+       *    The time a completed response can be handed out to later callers, zero only merges requests in flight
+      */
+      CoalescingDriver(Driver& driver, std::chrono::microseconds const& freshness = std::chrono::microseconds::zero());
+      CoalescingDriver() = delete;
+      CoalescingDriver(CoalescingDriver const&) = delete;
+      CoalescingDriver& operator = (CoalescingDriver const&) = delete;
+      CoalescingDriver(CoalescingDriver&&) = delete;
+      CoalescingDriver& operator = (CoalescingDriver&&) = delete;
+
+      /**\fn addId
+       * \brief
+       *    Registers the actuator id with the underlying driver
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+      */
+      void addId(std::uint32_t const actuator_id) override;
+
+      /**\fn send
+       * \brief
+       *    Forwards the message to the underlying driver and invalidates the cached responses of the actuator
+       *
+       * \param[in] msg
+       *    The message that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+      */
+      void send(Message const& msg, std::uint32_t const actuator_id) override;
+
+      /**\fn sendRecv
+       * \brief
+       *    Sends the request unless an identical read is already in flight or was completed recently
+       *
+       * \param[in] request
+       *    Request that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+       * \return
+       *    The response bytes
+      */
+      [[nodiscard]]
+      std::array<std::uint8_t,8> sendRecv(Message const& request, std::uint32_t const actuator_id) override;
+
+      /**\fn getNumForwarded
+       * \brief
+       *    Get the number of requests that were actually forwarded to the underlying driver
+       *
+       * \return
+       *    The number of forwarded requests
+      */
+      [[nodiscard]]
+      std::uint64_t getNumForwarded() const noexcept;
+
+      /**\fn getNumCoalesced
+       * \brief
+       *    Get the number of reads that joined an identical read that was in flight
+       *
+       * \return
+       *    The number of coalesced reads
+      */
+      [[nodiscard]]
+      std::uint64_t getNumCoalesced() const noexcept;
+
+      /**\fn getNumCached
+       * \brief
+       *    Get the number of reads that were answered by a response within the freshness window
+       *
+       * \return
+       *    The number of reads answered from the cache
+      */
+      [[nodiscard]]
+      std::uint64_t getNumCached() const noexcept;
+
+    protected:
+      using Clock = std::chrono::steady_clock;
+      using Key = std::pair<std::uint32_t,std::array<std::uint8_t,8>>;
+
+      /**\class Flight
+       * \brief
+       *    A read that is either in flight or has been completed
+      */
+      class Flight {
+        public:
+          std::promise<std::array<std::uint8_t,8>> promise;
+          std::shared_future<std::array<std::uint8_t,8>> response;
+          bool is_done;
+          Clock::time_point completed_at;
+      };
+
+      /**\fn invalidate
+       * \brief
+       *    Drops all completed responses and reads in flight of the given actuator so that no later read joins
+       *    or reuses a read that was issued before its state was altered
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator whose state was altered
+      */
+      void invalidate(std::uint32_t const actuator_id);
+
+      Driver& driver_;
+      std::chrono::nanoseconds freshness_;
+      std::mutex mutex_;
+      std::map<Key,std::shared_ptr<Flight>> flights_;
+      std::atomic<std::uint64_t> num_forwarded_;
+      std::atomic<std::uint64_t> num_coalesced_;
+      std::atomic<std::uint64_t> num_cached_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__DRIVER__COALESCING_DRIVER
@@ -19,8 +19,6 @@
 
 namespace myactuator_rmd {
 
-  class ActuatorInterface;
-
   /**\class Driver
    * \brief
    *    Pure abstract base class for drivers
@@ -67,8 +65,6 @@ namespace myactuator_rmd {
       Driver& operator = (Driver const&) = default;
       Driver(Driver&&) = default;
       Driver& operator = (Driver&&) = default;
-
-      friend ActuatorInterface;
   };
 
 }
@@ -0,0 +1,231 @@
+/**
+ * \file multi_bus_driver.hpp
+ * \mainpage
+ *    Contains a driver for actuators distributed over several CAN interfaces
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__DRIVER__MULTI_BUS_DRIVER
+#define MYACTUATOR_RMD__DRIVER__MULTI_BUS_DRIVER
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "myactuator_rmd/driver/can_driver.hpp"
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class BusAddress
+   * \brief
+   *    Address of an actuator consisting of the index of its bus and its id on that bus
+  */
+  class BusAddress {
+    public:
+      /**\fn BusAddress
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] bus_
+       *    The index of the bus the actuator is connected to
+       * \param[in] actuator_id_
+       *    The id of the actuator on this bus
+      */
+      constexpr BusAddress(std::size_t const bus_, std::uint32_t const actuator_id_) noexcept;
+      BusAddress() = delete;
+      BusAddress(BusAddress const&) = default;
+      BusAddress& operator = (BusAddress const&) = default;
+      BusAddress(BusAddress&&) = default;
+      BusAddress& operator = (BusAddress&&) = default;
+
+      std::size_t bus;
+      std::uint32_t actuator_id;
+  };
+
+  constexpr BusAddress::BusAddress(std::size_t const bus_, std::uint32_t const actuator_id_) noexcept
+  : bus{bus_}, actuator_id{actuator_id_} {
+    return;
+  }
+
+  /**\class AddressedMessage
+   * \brief
+   *    A message together with the address of the actuator it should be sent to
+  */
+  class AddressedMessage {
+    public:
+      /**\fn AddressedMessage
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] address_
+       *    The address of the actuator the message should be sent to
+       * \param[in] message_
+       *    The message that should be sent
+      */
+      AddressedMessage(BusAddress const& address_, Message const& message_) noexcept;
+      AddressedMessage() = delete;
+      AddressedMessage(AddressedMessage const&) = default;
+      AddressedMessage& operator = (AddressedMessage const&) = default;
+      AddressedMessage(AddressedMessage&&) = default;
+      AddressedMessage& operator = (AddressedMessage&&) = default;
+
+      BusAddress address;
+      RawMessage message;
+  };
+
+  /**\class BusConfiguration
+   * \brief
+   *    Configuration of a single bus of a multi-bus driver
+  */
+  class BusConfiguration {
+    public:
+      /**\fn BusConfiguration
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] ifname_
+       *    The name of the network interface, e.g. 'can0'
+       * \param[in] cpu_
+       *    The CPU the I/O thread of this bus should be pinned to, not pinned if not given
+       * \param[in] cycle_time_
+       *    The period of the control cycle used for scheduling lower priority classes, see ThreadSafeDriver
+      */
+      BusConfiguration(std::string const& ifname_, std::optional<int> const& cpu_ = std::nullopt,
+                       std::chrono::microseconds const& cycle_time_ = std::chrono::microseconds::zero());
+      BusConfiguration() = delete;
+      BusConfiguration(BusConfiguration const&) = default;
+      BusConfiguration& operator = (BusConfiguration const&) = default;
+      BusConfiguration(BusConfiguration&&) = default;
+      BusConfiguration& operator = (BusConfiguration&&) = default;
+
+      std::string ifname;
+      std::optional<int> cpu;
+      std::chrono::microseconds cycle_time;
+  };
+
+  /**\class MultiBusDriver
+   * \brief
+   *    Driver for actuators distributed over several CAN interfaces. Each bus is served by its own I/O thread,
+   *    optionally pinned to a given CPU, so that the buses are operated in parallel. Actuators are addressed
+   *    by their bus and id. A whole control cycle can be issued on all buses at once and its replies joined.
+  */
+  class MultiBusDriver {
+    public:
+      /**\fn MultiBusDriver
+       * \brief
+       *    Class constructor, opens the network interfaces and starts one I/O thread per bus
+       *
+       * \param[in] buses
+       *    The configuration of each bus, their index corresponds to the bus index of the actuator addresses
+      */
+      MultiBusDriver(std::vector<BusConfiguration> const& buses);
+
+      /**\fn MultiBusDriver
+       * \brief
+       *    Class constructor, starts one I/O thread for each of the given drivers
+       *
+       * \param[in] drivers
+       *    The drivers communicating over the individual buses, must not be used directly while this driver exists
+       * \param[in] cpus
+       *    The CPU the I/O thread of each bus should be pinned to, empty if they should not be pinned
+      */
+      MultiBusDriver(std::vector<std::reference_wrapper<Driver>> const& drivers,
+                     std::vector<std::optional<int>> const& cpus = {});
+      MultiBusDriver() = delete;
+      MultiBusDriver(MultiBusDriver const&) = delete;
+      MultiBusDriver& operator = (MultiBusDriver const&) = delete;
+      MultiBusDriver(MultiBusDriver&&) = delete;
+      MultiBusDriver& operator = (MultiBusDriver&&) = delete;
+      ~MultiBusDriver();
+
+      /**\fn getNumBuses
+       * \brief
+       *    Get the number of buses operated by this driver
+       *
+       * \return
+       *    The number of buses
+      */
+      [[nodiscard]]
+      std::size_t getNumBuses() const noexcept;
+
+      /**\fn getBus
+       * \brief
+       *    Get the thread-safe driver of a single bus, e.g. for creating an actuator interface with it
+       *
+       * \param[in] bus
+       *    The index of the bus
+       * \return
+       *    The driver of the bus
+      */
+      [[nodiscard]]
+      ThreadSafeDriver& getBus(std::size_t const bus);
+
+      /**\fn addId
+       * \brief
+       *    Registers the actuator with the driver of its bus
+       *
+       * \param[in] address
+       *    The address of the actuator
+      */
+      void addId(BusAddress const& address);
+
+      /**\fn send
+       * \brief
+       *    Sends a message to a single actuator and blocks until it was written
+       *
+       * \param[in] msg
+       *    The message that should be sent to the corresponding actuator
+       * \param[in] address
+       *    The address of the actuator
+      */
+      void send(Message const& msg, BusAddress const& address);
+
+      /**\fn sendRecv
+       * \brief
+       *    Sends a request to a single actuator and blocks until its reply was received
+       *
+       * \param[in] request
+       *    Request that should be sent to the corresponding actuator
+       * \param[in] address
+       *    The address of the actuator
+       * \return
+       *    The response bytes
+      */
+      [[nodiscard]]
+      std::array<std::uint8_t,8> sendRecv(Message const& request, BusAddress const& address);
+
+      /**\fn sendRecv
+       * \brief
+       *    Issues all requests at once and joins their replies: Requests to different buses are processed in
+       *    parallel while requests to the same bus are sent in the given order (within their priority class).
+       *
+       * \param[in] requests
+       *    The requests of a control cycle together with the addresses of their actuators
+       * \return
+       *    The response bytes in the order of the requests
+       * \throws
+       *    The first exception raised by any of the requests after all other requests have completed
+      */
+      [[nodiscard]]
+      std::vector<std::array<std::uint8_t,8>> sendRecv(std::vector<AddressedMessage> const& requests);
+
+    protected:
+      std::vector<std::unique_ptr<CanDriver>> can_drivers_;
+      std::vector<std::unique_ptr<ThreadSafeDriver>> buses_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__DRIVER__MULTI_BUS_DRIVER
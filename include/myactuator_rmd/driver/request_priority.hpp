@@ -0,0 +1,119 @@
+/**
+ * \file request_priority.hpp
+ * \mainpage
+ *    Contains the priority classes of requests sent over the bus
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__DRIVER__REQUEST_PRIORITY
+#define MYACTUATOR_RMD__DRIVER__REQUEST_PRIORITY
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "myactuator_rmd/protocol/command_type.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\enum RequestPriority
+   * \brief
+   *    Priority class of a request, lower values are served first
+  */
+  enum class RequestPriority: std::uint8_t {
+    REAL_TIME = 0, // Set-points and commands stopping the actuator
+    STATE = 1, // Reading the current state of the actuator
+    CONFIGURATION = 2 // Configuration and diagnostics
+  };
+
+  // Number of different priority classes
+  inline constexpr std::size_t num_request_priorities {3};
+
+  /**\fn getRequestPriority
+   * \brief
+   *    Get the default priority class of a given command
+   *
+   * \param[in] command
+   *    The command that should be sent to the actuator
+   * \return
+   *    The priority class that the command belongs to
+  */
+  [[nodiscard]]
+  constexpr RequestPriority getRequestPriority(CommandType const command) noexcept {
+    switch (command) {
+      case CommandType::TORQUE_CLOSED_LOOP_CONTROL:
+      case CommandType::SPEED_CLOSED_LOOP_CONTROL:
+      case CommandType::ABSOLUTE_POSITION_CLOSED_LOOP_CONTROL:
+      case CommandType::SHUTDOWN_MOTOR:
+      case CommandType::STOP_MOTOR:
+      case CommandType::RELEASE_BRAKE:
+      case CommandType::LOCK_BRAKE:
+        return RequestPriority::REAL_TIME;
+      case CommandType::READ_MULTI_TURN_ENCODER_POSITION:
+      case CommandType::READ_MULTI_TURN_ENCODER_ORIGINAL_POSITION:
+      case CommandType::READ_SINGLE_TURN_ENCODER:
+      case CommandType::READ_MULTI_TURN_ANGLE:
+      case CommandType::READ_SINGLE_TURN_ANGLE:
+      case CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG:
+      case CommandType::READ_MOTOR_STATUS_2:
+      case CommandType::READ_MOTOR_STATUS_3:
+      case CommandType::READ_SYSTEM_OPERATING_MODE:
+      case CommandType::READ_MOTOR_POWER:
+        return RequestPriority::STATE;
+      default:
+        return RequestPriority::CONFIGURATION;
+    }
+  }
+
+  /**\class PriorityStatistics
+   * \brief
+   *    Counters for the requests of a single priority class that allow measuring preemption and fairness
+  */
+  class PriorityStatistics {
+    public:
+      /**\fn PriorityStatistics
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] num_requests_
+       *    Number of requests of this class that were processed
+       * \param[in] num_preemptions_
+       *    Number of times a waiting request of this class was overtaken by a request of a higher class
+       * \param[in] num_deferrals_
+       *    Number of times a request of this class was deferred to the next cycle due to lacking bus time
+       * \param[in] total_waiting_time_
+       *    Accumulated time that requests of this class waited in the queue before being processed
+       * \param[in] max_waiting_time_
+       *    The maximum time a single request of this class waited in the queue before being processed
+      */
+      constexpr PriorityStatistics(std::uint64_t const num_requests_ = 0, std::uint64_t const num_preemptions_ = 0,
+                                   std::uint64_t const num_deferrals_ = 0,
+                                   std::chrono::nanoseconds const total_waiting_time_ = std::chrono::nanoseconds::zero(),
+                                   std::chrono::nanoseconds const max_waiting_time_ = std::chrono::nanoseconds::zero()) noexcept;
+      PriorityStatistics(PriorityStatistics const&) = default;
+      PriorityStatistics& operator = (PriorityStatistics const&) = default;
+      PriorityStatistics(PriorityStatistics&&) = default;
+      PriorityStatistics& operator = (PriorityStatistics&&) = default;
+
+      std::uint64_t num_requests;
+      std::uint64_t num_preemptions;
+      std::uint64_t num_deferrals;
+      std::chrono::nanoseconds total_waiting_time;
+      std::chrono::nanoseconds max_waiting_time;
+  };
+
+  constexpr PriorityStatistics::PriorityStatistics(std::uint64_t const num_requests_, std::uint64_t const num_preemptions_,
+                                                   std::uint64_t const num_deferrals_,
+                                                   std::chrono::nanoseconds const total_waiting_time_,
+                                                   std::chrono::nanoseconds const max_waiting_time_) noexcept
+  : num_requests{num_requests_}, num_preemptions{num_preemptions_}, num_deferrals{num_deferrals_},
+    total_waiting_time{total_waiting_time_}, max_waiting_time{max_waiting_time_} {
+    return;
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__DRIVER__REQUEST_PRIORITY
@@ -0,0 +1,75 @@
+/**
+ * \file response_listener.hpp
+ * \mainpage
+ *    Contains the interface for components that are notified of every response received by a driver
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__DRIVER__RESPONSE_LISTENER
+#define MYACTUATOR_RMD__DRIVER__RESPONSE_LISTENER
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace myactuator_rmd {
+
+  /**\class ResponseListener
+   * \brief
+   *    Interface for components that are notified of every response received by a driver, e.g. caches or
+   *    estimators of the actuator state. The listener is called from the thread communicating over the bus and
+   *    should therefore return quickly and not block.
+   *    Listeners keep their state in fixed arrays indexed by the actuator id. They are updated by a single thread,
+   *    usually the bus thread of a ThreadSafeDriver they are registered with, and publish their state through
+   *    sequence locks (see SeqLock) so that any number of threads can read it without locks.
+  */
+  class ResponseListener {
+    public:
+      /**\fn onResponse
+       * \brief
+       *    Called for every response that was received
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator that the response was received from
+       * \param[in] response
+       *    The response bytes
+       * \param[in] timestamp
+       *    The time the response was received
+      */
+      virtual void onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                              std::chrono::steady_clock::time_point const& timestamp) noexcept = 0;
+
+      // Maximum number of actuators that can be addressed on a single bus
+      static constexpr std::size_t max_num_actuators {32};
+
+    protected:
+      ResponseListener() = default;
+      ResponseListener(ResponseListener const&) = default;
+      ResponseListener& operator = (ResponseListener const&) = default;
+      ResponseListener(ResponseListener&&) = default;
+      ResponseListener& operator = (ResponseListener&&) = default;
+
+      /**\fn isValidId
+       * \brief
+       *    Check whether an actuator id can be addressed on a single bus
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    Boolean flag signaling whether the actuator id is within [1, 32]
+      */
+      [[nodiscard]]
+      static constexpr bool isValidId(std::uint32_t const actuator_id) noexcept;
+  };
+
+  constexpr bool ResponseListener::isValidId(std::uint32_t const actuator_id) noexcept {
+    return (actuator_id >= 1) && (actuator_id <= max_num_actuators);
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__DRIVER__RESPONSE_LISTENER
@@ -0,0 +1,211 @@
+/**
+ * \file seq_lock.hpp
+ * \mainpage
+ *    Contains a sequence lock for publishing a value from a single writer to any number of readers
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__DRIVER__SEQ_LOCK
+#define MYACTUATOR_RMD__DRIVER__SEQ_LOCK
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+
+namespace myactuator_rmd {
+
+  /**\class SeqLock
+   * \brief
+   *    Sequence lock holding a single value that is written by a single thread and read by any number of
+   *    threads without locks: Readers never block the writer and only retry in the rare case that the value was
+   *    written while it was being read. Every write increments the version of the value, an odd sequence number
+   *    marks a write in progress and zero a value that was never written. By default each lock occupies its own
+   *    cache line.
+   *
+   * \tparam T
+   *    The trivially copyable type of the value
+   * \tparam Alignment
+   *    The alignment of the lock, at least the one of a 64-bit integer. A smaller alignment than the size of a
+   *    cache line packs arrays of locks that are accessed one after another, e.g. the entries of a ring buffer.
+  */
+  template <typename T, std::size_t Alignment = 64>
+  class alignas(Alignment) SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "Value has to be trivially copyable");
+    static_assert(std::is_default_constructible_v<T>, "Value has to be default constructible");
+    static_assert(Alignment >= alignof(std::uint64_t), "Alignment has to be at least the one of a 64-bit integer");
+
+    public:
+      constexpr SeqLock() noexcept;
+      SeqLock(SeqLock const&) = delete;
+      SeqLock& operator = (SeqLock const&) = delete;
+      SeqLock(SeqLock&&) = delete;
+      SeqLock& operator = (SeqLock&&) = delete;
+
+      /**\fn store
+       * \brief
+       *    Publishes a new value incrementing its version, must only be called from the writing thread
+       *
+       * \param[in] value
+       *    The value to be published
+      */
+      void store(T const& value) noexcept;
+
+      /**\fn store
+       * \brief
+       *    Publishes a new value with a given version, must only be called from the writing thread
+       *
+       * \param[in] value
+       *    The value to be published
+       * \param[in] version
+       *    The version of the value, has to be positive
+      */
+      void store(T const& value, std::uint64_t const version) noexcept;
+
+      /**\fn load
+       * \brief
+       *    Reads a consistent copy of the value, retrying if it was written concurrently
+       *
+       * \return
+       *    The value or an empty optional if it was never written
+      */
+      [[nodiscard]]
+      std::optional<T> load() const noexcept;
+
+      /**\fn load
+       * \brief
+       *    Tries to read a consistent copy of a given version of the value without retrying
+       *
+       * \param[in] version
+       *    The expected version of the value
+       * \return
+       *    The value or an empty optional if the value has a different version or was written concurrently
+      */
+      [[nodiscard]]
+      std::optional<T> load(std::uint64_t const version) const noexcept;
+
+      /**\fn loadOwned
+       * \brief
+       *    Reads the value from the writing thread without checking for concurrent writes as there can not be
+       *    any, e.g. for updating the value based on its previous state
+       *
+       * \return
+       *    The value or an empty optional if it was never written
+      */
+      [[nodiscard]]
+      std::optional<T> loadOwned() const noexcept;
+
+      /**\fn getVersion
+       * \brief
+       *    Get the version of the latest completed write
+       *
+       * \return
+       *    The number of writes or the version of the last write, zero if it was never written
+      */
+      [[nodiscard]]
+      std::uint64_t getVersion() const noexcept;
+
+    protected:
+      // The value is split into atomic words so that concurrent reads are well-defined
+      static constexpr std::size_t num_words {(sizeof(T) + sizeof(std::uint64_t) - 1)/sizeof(std::uint64_t)};
+
+      /**\fn read
+       * \brief
+       *    Reads the value without checking for concurrent writes
+       *
+       * \return
+       *    The possibly torn value
+      */
+      [[nodiscard]]
+      T read() const noexcept;
+
+      std::atomic<std::uint64_t> sequence_;
+      std::array<std::atomic<std::uint64_t>,num_words> words_;
+  };
+
+  template <typename T, std::size_t Alignment>
+  constexpr SeqLock<T,Alignment>::SeqLock() noexcept
+  : sequence_{0}, words_{} {
+    return;
+  }
+
+  template <typename T, std::size_t Alignment>
+  void SeqLock<T,Alignment>::store(T const& value) noexcept {
+    store(value, sequence_.load(std::memory_order_relaxed)/2 + 1);
+    return;
+  }
+
+  template <typename T, std::size_t Alignment>
+  void SeqLock<T,Alignment>::store(T const& value, std::uint64_t const version) noexcept {
+    std::array<std::uint64_t,num_words> words {};
+    std::memcpy(words.data(), &value, sizeof(T));
+    sequence_.store(2*version - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words_[i].store(words[i], std::memory_order_relaxed);
+    }
+    sequence_.store(2*version, std::memory_order_release);
+    return;
+  }
+
+  template <typename T, std::size_t Alignment>
+  std::optional<T> SeqLock<T,Alignment>::load() const noexcept {
+    std::uint64_t sequence_before {};
+    T value {};
+    do {
+      sequence_before = sequence_.load(std::memory_order_acquire);
+      value = read();
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence_before & 1) || (sequence_before != sequence_.load(std::memory_order_relaxed)));
+    if (sequence_before == 0) {
+      return std::nullopt;
+    }
+    return value;
+  }
+
+  template <typename T, std::size_t Alignment>
+  std::optional<T> SeqLock<T,Alignment>::load(std::uint64_t const version) const noexcept {
+    auto const sequence_before {sequence_.load(std::memory_order_acquire)};
+    auto const value {read()};
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto const sequence_after {sequence_.load(std::memory_order_relaxed)};
+    if ((version == 0) || (sequence_before != 2*version) || (sequence_after != 2*version)) {
+      return std::nullopt;
+    }
+    return value;
+  }
+
+  template <typename T, std::size_t Alignment>
+  std::optional<T> SeqLock<T,Alignment>::loadOwned() const noexcept {
+    if (sequence_.load(std::memory_order_relaxed) == 0) {
+      return std::nullopt;
+    }
+    return read();
+  }
+
+  template <typename T, std::size_t Alignment>
+  std::uint64_t SeqLock<T,Alignment>::getVersion() const noexcept {
+    return sequence_.load(std::memory_order_acquire)/2;
+  }
+
+  template <typename T, std::size_t Alignment>
+  T SeqLock<T,Alignment>::read() const noexcept {
+    std::array<std::uint64_t,num_words> words {};
+    for (std::size_t i = 0; i < num_words; ++i) {
+      words[i] = words_[i].load(std::memory_order_relaxed);
+    }
+    T value {};
+    // The type is trivially copyable even if it is not trivially default constructible
+    std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+    return value;
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__DRIVER__SEQ_LOCK
@@ -0,0 +1,347 @@
+/**
+ * \file thread_safe_driver.hpp
+ * \mainpage
+ *    Contains a driver that allows a single driver to be shared between several threads
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__DRIVER__THREAD_SAFE_DRIVER
+#define MYACTUATOR_RMD__DRIVER__THREAD_SAFE_DRIVER
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <thread>
+
+#include <semaphore.h>
+
+#include "myactuator_rmd/concurrency/mpsc_queue.hpp"
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/driver/request_priority.hpp"
+#include "myactuator_rmd/driver/response_listener.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class ThreadSafeDriver
+   * \brief
+   *    Driver that serialises the access to another driver (e.g. a CanDriver) so that actuator interfaces
+   *    sharing it can be used from different threads. Callers enqueue their requests into a lock-free queue
+   *    that is drained by a single bus thread which is the only thread that ever talks to the underlying driver.
+   *    The reply is handed back to each caller individually so that callers never block each other.
+   *    Requests are served by priority class: Set-points are always sent first while state reads and
+   *    configuration requests only use the bus time that is left over in each cycle.
+   * \warning
+   *    The underlying driver must not be used directly as long as this driver exists
+  */
+  class ThreadSafeDriver: public Driver {
+    public:
+      using Clock = std::chrono::steady_clock;
+
+      /**\enum RequestType
+       * \brief
+       *    The operation that the bus thread should perform on the underlying driver
+      */
+      enum class RequestType {
+        ADD_ID,
+        SEND,
+        SEND_RECV
+      };
+
+      /**\class BusRequest
+       * \brief
+       *    A single request handed over to the bus thread. It is owned by the caller, usually on its stack, and
+       *    has to outlive its processing: The caller waits on its semaphore until the bus thread has processed it
+       *    or is notified by a completion callback from inside the bus thread.
+      */
+      class BusRequest: public MpscNode {
+        public:
+          /**\fn BusRequest
+           * \brief
+           *    Class constructor
+           *
+           * \param[in] type_
+           *    The operation that should be performed
+           * \param[in] actuator_id_
+           *    The ID of the actuator that the message should be sent to
+           * \param[in] message_
+           *    The message that should be sent
+           * \param[in] priority_
+           *    The priority class the message should be sent with
+          */
+          BusRequest(RequestType const type_, std::uint32_t const actuator_id_, Message const& message_,
+                     RequestPriority const priority_);
+          BusRequest() = delete;
+          BusRequest(BusRequest const&) = delete;
+          BusRequest& operator = (BusRequest const&) = delete;
+          BusRequest(BusRequest&&) = delete;
+          BusRequest& operator = (BusRequest&&) = delete;
+          ~BusRequest();
+
+          /**\fn complete
+           * \brief
+           *    Signals the owner of the request that it has been processed, called once by the bus thread
+          */
+          void complete() noexcept;
+
+          RequestType type;
+          std::uint32_t actuator_id;
+          RawMessage message;
+          RequestPriority priority;
+          Clock::time_point enqueued_at;
+          std::uint64_t deferred_cycle;
+          std::array<std::uint8_t,8> response;
+          std::exception_ptr exception;
+          ::sem_t is_done;
+          void (*on_completion)(BusRequest&) noexcept; // Called instead of signaling the semaphore if set
+      };
+
+      /**\fn ThreadSafeDriver
+       * \brief
+       *    Class constructor, starts the bus thread
+       *
+       * \param[in] driver
+       *    The driver communicating over the network interface that should be shared
+       * \param[in] cycle_time
+       *    The period of the control cycle. Requests of lower priority classes are only started if they are
+       *    expected to finish before the end of the current cycle. Zero disables this and only orders by priority.
+       * \param[in] cpu
+       *    The CPU the bus thread should be pinned to, not pinned if not given
+      */
+      ThreadSafeDriver(Driver& driver, std::chrono::microseconds const& cycle_time = std::chrono::microseconds::zero(),
+                       std::optional<int> const& cpu = std::nullopt);
+      ThreadSafeDriver() = delete;
+      ThreadSafeDriver(ThreadSafeDriver const&) = delete;
+      ThreadSafeDriver& operator = (ThreadSafeDriver const&) = delete;
+      ThreadSafeDriver(ThreadSafeDriver&&) = delete;
+      ThreadSafeDriver& operator = (ThreadSafeDriver&&) = delete;
+      ~ThreadSafeDriver();
+
+      /**\fn addId
+       * \brief
+       *    Registers the actuator id with the underlying driver from inside the bus thread
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+      */
+      void addId(std::uint32_t const actuator_id) override;
+
+      /**\fn send
+       * \brief
+       *    Enqueues the message and blocks until it was written by the bus thread
+       *
+       * \param[in] msg
+       *    The message that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+      */
+      void send(Message const& msg, std::uint32_t const actuator_id) override;
+
+      /**\fn send
+       * \brief
+       *    Enqueues the message with a given priority and blocks until it was written by the bus thread
+       *
+       * \param[in] msg
+       *    The message that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+       * \param[in] priority
+       *    The priority class the message should be sent with
+      */
+      void send(Message const& msg, std::uint32_t const actuator_id, RequestPriority const priority);
+
+      /**\fn sendRecv
+       * \brief
+       *    Enqueues the request and blocks until the bus thread has received the corresponding reply
+       *
+       * \param[in] request
+       *    Request that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+       * \return
+       *    The response bytes
+      */
+      [[nodiscard]]
+      std::array<std::uint8_t,8> sendRecv(Message const& request, std::uint32_t const actuator_id) override;
+
+      /**\fn sendRecv
+       * \brief
+       *    Enqueues the request with a given priority and blocks until the bus thread has received the reply
+       *
+       * \param[in] request
+       *    Request that should be sent to the corresponding actuator
+       * \param[in] actuator_id
+       *    The ID of the actuator that the message should be sent to
+       * \param[in] priority
+       *    The priority class the request should be sent with
+       * \return
+       *    The response bytes
+      */
+      [[nodiscard]]
+      std::array<std::uint8_t,8> sendRecv(Message const& request, std::uint32_t const actuator_id, RequestPriority const priority);
+
+      /**\fn getStatistics
+       * \brief
+       *    Get the counters of a priority class, can be called from any thread
+       *
+       * \param[in] priority
+       *    The priority class of interest
+       * \return
+       *    A snapshot of the counters of the given priority class
+      */
+      [[nodiscard]]
+      PriorityStatistics getStatistics(RequestPriority const priority) const noexcept;
+
+      /**\fn addListener
+       * \brief
+       *    Registers a listener that is notified of every response from inside the bus thread, can be called
+       *    from any thread. Listeners can not be removed again.
+       *
+       * \param[in] listener
+       *    The listener to be notified, has to outlive the driver
+      */
+      void addListener(ResponseListener& listener);
+
+      // Maximum number of listeners that can be registered
+      static constexpr std::size_t max_num_listeners {8};
+
+      /**\fn enqueue
+       * \brief
+       *    Hands the request over to the bus thread without waiting for it to be processed. This allows a
+       *    caller to issue several requests at once, e.g. to different buses, and to wait for all of them later.
+       *
+       * \param[in,out] request
+       *    The request to be processed, has to outlive its processing and must only be enqueued once
+      */
+      void enqueue(BusRequest& request);
+
+      /**\fn wait
+       * \brief
+       *    Blocks until a previously enqueued request has been processed by the bus thread
+       *
+       * \param[in,out] request
+       *    The enqueued request, contains the response after the call
+       * \throws
+       *    The exception raised by the underlying driver while processing the request
+      */
+      void wait(BusRequest& request);
+
+    protected:
+      /**\fn submit
+       * \brief
+       *    Hands the request over to the bus thread and waits for it to be processed
+       *
+       * \param[in,out] request
+       *    The request to be processed, contains the response after the call
+      */
+      void submit(BusRequest& request);
+
+      /**\class AtomicPriorityStatistics
+       * \brief
+       *    Counters of a single priority class that are written by the bus thread and read by any thread
+      */
+      class AtomicPriorityStatistics {
+        public:
+          std::atomic<std::uint64_t> num_requests {0};
+          std::atomic<std::uint64_t> num_preemptions {0};
+          std::atomic<std::uint64_t> num_deferrals {0};
+          std::atomic<std::int64_t> total_waiting_time_ns {0};
+          std::atomic<std::int64_t> max_waiting_time_ns {0};
+      };
+
+      /**\fn selectRequest
+       * \brief
+       *    Selects the next request to be processed by the bus thread
+       *
+       * \param[in] now
+       *    The current time
+       * \param[out] is_deferred
+       *    Set to true if there are requests that were held back until the next cycle
+       * \return
+       *    The request to be processed next or a nullptr if there is none that can be processed now
+      */
+      [[nodiscard]]
+      BusRequest* selectRequest(Clock::time_point const& now, bool& is_deferred) noexcept;
+
+      /**\fn isWithinBudget
+       * \brief
+       *    Check if a request is expected to finish before the end of the current cycle
+       *
+       * \param[in] request
+       *    The request to be checked
+       * \param[in] now
+       *    The current time
+       * \return
+       *    Boolean flag signaling whether there is enough bus time left in the current cycle
+      */
+      [[nodiscard]]
+      bool isWithinBudget(BusRequest const& request, Clock::time_point const& now) const noexcept;
+
+      /**\fn getCycle
+       * \brief
+       *    Get the index of the cycle the given time falls into
+       *
+       * \param[in] time
+       *    The time of interest
+       * \return
+       *    The index of the cycle since the start of the driver
+      */
+      [[nodiscard]]
+      std::uint64_t getCycle(Clock::time_point const& time) const noexcept;
+
+      /**\fn waitUntil
+       * \brief
+       *    Waits for a new request to be enqueued but at most until the given time
+       *
+       * \param[in] deadline
+       *    The latest time to wait for
+       * \return
+       *    Boolean flag signaling whether a new request was enqueued
+      */
+      bool waitUntil(Clock::time_point const& deadline) noexcept;
+
+      /**\fn process
+       * \brief
+       *    Performs the given request on the underlying driver and signals the waiting caller
+       *
+       * \param[in,out] request
+       *    The request to be processed
+      */
+      void process(BusRequest& request) noexcept;
+
+      /**\fn run
+       * \brief
+       *    Main loop of the bus thread
+      */
+      void run() noexcept;
+
+      /**\fn stop
+       * \brief
+       *    Stops the bus thread and fails all requests that have not been processed yet
+      */
+      void stop() noexcept;
+
+      Driver& driver_;
+      std::chrono::nanoseconds cycle_time_;
+      Clock::time_point start_time_;
+      std::array<MpscQueue<BusRequest>,num_request_priorities> queues_;
+      std::array<BusRequest*,num_request_priorities> heads_;
+      std::array<std::chrono::nanoseconds,num_request_priorities> estimated_durations_;
+      std::array<AtomicPriorityStatistics,num_request_priorities> statistics_;
+      std::array<std::atomic<ResponseListener*>,max_num_listeners> listeners_;
+      std::atomic<std::size_t> num_listeners_;
+      ::sem_t num_pending_;
+      std::atomic<bool> is_running_;
+      std::thread bus_thread_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__DRIVER__THREAD_SAFE_DRIVER
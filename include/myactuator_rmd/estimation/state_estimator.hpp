@@ -0,0 +1,154 @@
+/**
+ * \file state_estimator.hpp
+ * \mainpage
+ *    Contains an estimator for the position and velocity of each actuator in between received samples
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__ESTIMATION__STATE_ESTIMATOR
+#define MYACTUATOR_RMD__ESTIMATION__STATE_ESTIMATOR
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "myactuator_rmd/driver/response_listener.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class EstimatedState
+   * \brief
+   *    Estimated position and velocity of an actuator at a given time
+  */
+  class EstimatedState {
+    public:
+      /**\fn EstimatedState
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] position_
+       *    The multi-turn position of the output shaft in degree
+       * \param[in] velocity_
+       *    The velocity of the output shaft in degree per second
+       * \param[in] age_
+       *    The time since the last sample that the estimate is based on was received
+      */
+      constexpr EstimatedState(double const position_ = 0.0, double const velocity_ = 0.0,
+                               std::chrono::steady_clock::duration const& age_ = {}) noexcept;
+      EstimatedState(EstimatedState const&) = default;
+      EstimatedState& operator = (EstimatedState const&) = default;
+      EstimatedState(EstimatedState&&) = default;
+      EstimatedState& operator = (EstimatedState&&) = default;
+
+      double position;
+      double velocity;
+      std::chrono::steady_clock::duration age;
+  };
+
+  constexpr EstimatedState::EstimatedState(double const position_, double const velocity_,
+                                           std::chrono::steady_clock::duration const& age_) noexcept
+  : position{position_}, velocity{velocity_}, age{age_} {
+    return;
+  }
+
+  /**\class StateEstimator
+   * \brief
+   *    Listener running an alpha-beta filter per actuator that fuses the shaft angle and speed of every feedback
+   *    as well as multi-turn angle readings with their receive times. The estimate is extrapolated to any
+   *    requested time so that an outer control loop can run faster than fresh samples arrive over the bus.
+  */
+  class StateEstimator: public ResponseListener {
+    public:
+      /**\fn StateEstimator
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] alpha
+       *    The weight of the position residual in the position estimate (0, 1]
+       * \param[in] beta
+       *    The weight of the position residual in the velocity estimate [0, 2)
+       * \param[in] speed_weight
+       *    The weight of the measured shaft speed in the velocity estimate [0, 1]
+       * \param[in] min_period
+       *    The lower bound for the time between samples used for correcting the velocity, avoids large velocity
+       *    steps caused by the quantisation of the angle of samples that arrive shortly after each other
+      */
+      StateEstimator(double const alpha = 0.5, double const beta = 0.1, double const speed_weight = 0.5,
+                     std::chrono::steady_clock::duration const& min_period = std::chrono::milliseconds(10));
+      StateEstimator(StateEstimator const&) = delete;
+      StateEstimator& operator = (StateEstimator const&) = delete;
+      StateEstimator(StateEstimator&&) = delete;
+      StateEstimator& operator = (StateEstimator&&) = delete;
+
+      /**\fn onResponse
+       * \brief
+       *    Updates the estimate of the actuator with the feedback or multi-turn angle of a response
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator that the response was received from [1, 32]
+       * \param[in] response
+       *    The response bytes, responses without a position are ignored
+       * \param[in] timestamp
+       *    The time the response was received
+      */
+      void onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                      std::chrono::steady_clock::time_point const& timestamp) noexcept override;
+
+      /**\fn getState
+       * \brief
+       *    Get the estimated state of an actuator at a given time
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \param[in] time
+       *    The time the state should be estimated for
+       * \return
+       *    The estimated state or an empty optional if no position was received for the actuator yet
+      */
+      [[nodiscard]]
+      std::optional<EstimatedState> getState(std::uint32_t const actuator_id,
+                                             std::chrono::steady_clock::time_point const& time = std::chrono::steady_clock::now()) const noexcept;
+
+    protected:
+      /**\fn update
+       * \brief
+       *    Performs a single step of the filter and publishes the new estimate
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator [1, 32]
+       * \param[in] position
+       *    The measured position in degree
+       * \param[in] speed
+       *    The measured speed in degree per second if it is part of the response
+       * \param[in] timestamp
+       *    The time the measurement was received
+      */
+      void update(std::uint32_t const actuator_id, double const position, std::optional<double> const& speed,
+                  std::chrono::steady_clock::time_point const& timestamp) noexcept;
+
+      /**\class Estimate
+       * \brief
+       *    Estimate of a single actuator at the time of the latest sample
+      */
+      class Estimate {
+        public:
+          double position;
+          double velocity;
+          std::chrono::steady_clock::time_point timestamp;
+      };
+
+      double alpha_;
+      double beta_;
+      double speed_weight_;
+      std::chrono::steady_clock::duration min_period_;
+      std::array<SeqLock<Estimate>,max_num_actuators> estimates_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__ESTIMATION__STATE_ESTIMATOR
@@ -0,0 +1,174 @@
+/**
+ * \file thermal_model.hpp
+ * \mainpage
+ *    Contains a thermal model predicting the winding temperature of each actuator from its current
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__ESTIMATION__THERMAL_MODEL
+#define MYACTUATOR_RMD__ESTIMATION__THERMAL_MODEL
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "myactuator_rmd/driver/response_listener.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class ThermalParameters
+   * \brief
+   *    Parameters of the first-order thermal model of an actuator
+  */
+  class ThermalParameters {
+    public:
+      /**\fn ThermalParameters
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] rated_current_
+       *    The rated current of the actuator in Ampere, refer to actuator_constants.hpp
+       * \param[in] rated_power_
+       *    The rated power of the actuator in Watt, refer to actuator_constants.hpp
+       * \param[in] thermal_resistance_
+       *    The thermal resistance between the windings and the ambient in Kelvin per Watt
+       * \param[in] time_constant_
+       *    The thermal time constant of the actuator in seconds
+       * \param[in] efficiency_
+       *    The efficiency at the rated operating point, the remaining rated power is dissipated as heat
+      */
+      constexpr ThermalParameters(float const rated_current_, float const rated_power_,
+                                  float const thermal_resistance_ = 1.5f, float const time_constant_ = 600.0f,
+                                  float const efficiency_ = 0.8f) noexcept;
+      ThermalParameters() = delete;
+      ThermalParameters(ThermalParameters const&) = default;
+      ThermalParameters& operator = (ThermalParameters const&) = default;
+      ThermalParameters(ThermalParameters&&) = default;
+      ThermalParameters& operator = (ThermalParameters&&) = default;
+
+      float rated_current;
+      float rated_power;
+      float thermal_resistance;
+      float time_constant;
+      float efficiency;
+  };
+
+  constexpr ThermalParameters::ThermalParameters(float const rated_current_, float const rated_power_,
+                                                 float const thermal_resistance_, float const time_constant_,
+                                                 float const efficiency_) noexcept
+  : rated_current{rated_current_}, rated_power{rated_power_}, thermal_resistance{thermal_resistance_},
+    time_constant{time_constant_}, efficiency{efficiency_} {
+    return;
+  }
+
+  /**\class ThermalModel
+   * \brief
+   *    Listener running a first-order thermal model per actuator that predicts its temperature from the current
+   *    contained in every feedback. The copper losses scale with the square of the current and are derived from
+   *    the losses at the rated operating point. The model is seeded with the first temperature that is received.
+   *    Every motor status 1 corrects the temperature as well as the ambient temperature. The temperature
+   *    contained in the feedback is measured in the same way but only corrects the model at a low rate: At the
+   *    rate of a control loop the model would otherwise follow the integer temperature readings immediately and
+   *    lose the sub-degree prediction between them.
+  */
+  class ThermalModel: public ResponseListener {
+    public:
+      /**\fn ThermalModel
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] parameters
+       *    The thermal parameters of the actuators
+       * \param[in] correction_gain
+       *    The weight of a measured temperature in the corrected estimate (0, 1]
+       * \param[in] correction_period
+       *    The minimum time between two corrections with the temperature contained in the feedback, every motor
+       *    status 1 corrects the model regardless
+      */
+      ThermalModel(ThermalParameters const& parameters, float const correction_gain = 0.5f,
+                   std::chrono::steady_clock::duration const& correction_period = std::chrono::seconds(1));
+      ThermalModel() = delete;
+      ThermalModel(ThermalModel const&) = delete;
+      ThermalModel& operator = (ThermalModel const&) = delete;
+      ThermalModel(ThermalModel&&) = delete;
+      ThermalModel& operator = (ThermalModel&&) = delete;
+
+      /**\fn onResponse
+       * \brief
+       *    Predicts the temperature up to the receive time of a feedback or a motor status 1 and corrects it with
+       *    the temperature contained in it
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator that the response was received from [1, 32]
+       * \param[in] response
+       *    The response bytes, other responses are ignored
+       * \param[in] timestamp
+       *    The time the response was received
+      */
+      void onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                      std::chrono::steady_clock::time_point const& timestamp) noexcept override;
+
+      /**\fn getTemperature
+       * \brief
+       *    Get the predicted temperature of an actuator at a given time assuming that the last current is kept
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \param[in] time
+       *    The time the temperature should be predicted for
+       * \return
+       *    The predicted temperature in degree Celsius or an empty optional if no temperature was received for
+       *    the actuator yet
+      */
+      [[nodiscard]]
+      std::optional<float> getTemperature(std::uint32_t const actuator_id,
+                                          std::chrono::steady_clock::time_point const& time = std::chrono::steady_clock::now()) const noexcept;
+
+    protected:
+      /**\class State
+       * \brief
+       *    Thermal state of a single actuator at the time of the latest response
+      */
+      class State {
+        public:
+          float temperature;
+          float ambient_temperature;
+          float current;
+          std::chrono::steady_clock::time_point timestamp;
+          std::chrono::steady_clock::time_point correction_timestamp;
+      };
+
+      /**\fn predict
+       * \brief
+       *    Predicts the temperature after a given time with a constant current
+       *
+       * \param[in] temperature
+       *    The temperature at the start in degree Celsius
+       * \param[in] ambient_temperature
+       *    The ambient temperature in degree Celsius
+       * \param[in] current
+       *    The current in Ampere
+       * \param[in] dt
+       *    The time since the start
+       * \return
+       *    The predicted temperature in degree Celsius
+      */
+      [[nodiscard]]
+      float predict(float const temperature, float const ambient_temperature, float const current,
+                    std::chrono::steady_clock::duration const& dt) const noexcept;
+
+      ThermalParameters parameters_;
+      float correction_gain_;
+      std::chrono::steady_clock::duration correction_period_;
+      float temperature_rise_per_square_current_; // Steady-state temperature rise per squared current in K/A^2
+      std::array<SeqLock<State>,max_num_actuators> states_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__ESTIMATION__THERMAL_MODEL
@@ -10,8 +10,30 @@
 #define MYACTUATOR_RMD__MYACTUATOR_RMD
 #pragma once
 
+#include "myactuator_rmd/driver/adaptive_timeout.hpp"
+#include "myactuator_rmd/driver/bus_planner.hpp"
 #include "myactuator_rmd/driver/can_driver.hpp"
+#include "myactuator_rmd/driver/coalescing_driver.hpp"
 #include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/driver/multi_bus_driver.hpp"
+#include "myactuator_rmd/driver/response_listener.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/estimation/state_estimator.hpp"
+#include "myactuator_rmd/estimation/thermal_model.hpp"
+#include "myactuator_rmd/protocol/command_traits.hpp"
+#include "myactuator_rmd/protocol/feedback_decoder.hpp"
+#include "myactuator_rmd/protocol/frame_decoder.hpp"
+#include "myactuator_rmd/protocol/response_view.hpp"
+#include "myactuator_rmd/realtime/cyclic_executor.hpp"
+#include "myactuator_rmd/telemetry/feedback_batch.hpp"
+#include "myactuator_rmd/telemetry/feedback_ring.hpp"
+#include "myactuator_rmd/telemetry/power_monitor.hpp"
+#include "myactuator_rmd/telemetry/quantile_sketch.hpp"
+#include "myactuator_rmd/telemetry/stamped_response.hpp"
+#include "myactuator_rmd/telemetry/state_cache.hpp"
+#include "myactuator_rmd/telemetry/state_history.hpp"
+#include "myactuator_rmd/telemetry/telemetry_poller.hpp"
 #include "myactuator_rmd/actuator_constants.hpp"
 #include "myactuator_rmd/actuator_interface.hpp"
 #include "myactuator_rmd/exceptions.hpp"
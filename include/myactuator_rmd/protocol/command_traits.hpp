@@ -0,0 +1,338 @@
+/**
+ * \file command_traits.hpp
+ * \mainpage
+ *    Contains a compile-time registry mapping each command to its request, response and result
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__PROTOCOL__COMMAND_TRAITS
+#define MYACTUATOR_RMD__PROTOCOL__COMMAND_TRAITS
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "myactuator_rmd/actuator_state/control_mode.hpp"
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/gains.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_2.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class CommandTraits
+   * \brief
+   *    Compile-time registry of the request, response and decoded result types of a command. Commands without
+   *    a response have the response type void, commands whose response only acknowledges them have the result
+   *    type void. Responses are decoded by the static function decode.
+   *    CommandType::CAN_ID_SETTING is not registered as reading and writing the CAN id share the same command.
+   *
+   * \tparam C
+   *    The type of the command
+  */
+  template <CommandType C>
+  class CommandTraits;
+
+  /**\class CommandTraitsBase
+   * \brief
+   *    Common base of all command traits defining the types involved in a command
+   *
+   * \tparam RequestT
+   *    The request sent to the actuator
+   * \tparam ResponseT
+   *    The response sent back by the actuator, void if it does not reply
+   * \tparam ResultT
+   *    The type the response is decoded to, void if it only acknowledges the request
+  */
+  template <typename RequestT, typename ResponseT, typename ResultT>
+  class CommandTraitsBase {
+    public:
+      using Request = RequestT;
+      using Response = ResponseT;
+      using Result = ResultT;
+
+      inline static constexpr bool is_reply_expected {!std::is_void_v<ResponseT>};
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_PID_PARAMETERS>: public CommandTraitsBase<GetControllerGainsRequest,GetControllerGainsResponse,Gains> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getGains();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::WRITE_PID_PARAMETERS_TO_RAM>: public CommandTraitsBase<SetControllerGainsRequest,SetControllerGainsResponse,Gains> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getGains();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::WRITE_PID_PARAMETERS_TO_ROM>: public CommandTraitsBase<SetControllerGainsPersistentlyRequest,SetControllerGainsPersistentlyResponse,Gains> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getGains();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_ACCELERATION>: public CommandTraitsBase<GetAccelerationRequest,GetAccelerationResponse,std::int32_t> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getAcceleration();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::WRITE_ACCELERATION_TO_RAM_AND_ROM>: public CommandTraitsBase<SetAccelerationRequest,SetAccelerationResponse,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MULTI_TURN_ENCODER_POSITION>: public CommandTraitsBase<GetMultiTurnEncoderPositionRequest,GetMultiTurnEncoderPositionResponse,std::int32_t> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getPosition();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MULTI_TURN_ENCODER_ORIGINAL_POSITION>: public CommandTraitsBase<GetMultiTurnEncoderOriginalPositionRequest,GetMultiTurnEncoderOriginalPositionResponse,std::int32_t> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getPosition();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MULTI_TURN_ENCODER_ZERO_OFFSET>: public CommandTraitsBase<GetMultiTurnEncoderZeroOffsetRequest,GetMultiTurnEncoderZeroOffsetResponse,std::int32_t> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getPosition();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::WRITE_ENCODER_MULTI_TURN_VALUE_TO_ROM_AS_ZERO>: public CommandTraitsBase<SetEncoderZeroRequest,SetEncoderZeroResponse,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::WRITE_CURRENT_MULTI_TURN_POSITION_TO_ROM_AS_ZERO>: public CommandTraitsBase<SetCurrentPositionAsEncoderZeroRequest,SetCurrentPositionAsEncoderZeroResponse,std::int32_t> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getEncoderZero();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_SINGLE_TURN_ENCODER>: public CommandTraitsBase<GetSingleTurnEncoderPositionRequest,GetSingleTurnEncoderPositionResponse,std::int16_t> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getPosition();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MULTI_TURN_ANGLE>: public CommandTraitsBase<GetMultiTurnAngleRequest,GetMultiTurnAngleResponse,float> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getAngle();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_SINGLE_TURN_ANGLE>: public CommandTraitsBase<GetSingleTurnAngleRequest,GetSingleTurnAngleResponse,float> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getAngle();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG>: public CommandTraitsBase<GetMotorStatus1Request,GetMotorStatus1Response,MotorStatus1> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getStatus();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MOTOR_STATUS_2>: public CommandTraitsBase<GetMotorStatus2Request,GetMotorStatus2Response,MotorStatus2> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getStatus();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MOTOR_STATUS_3>: public CommandTraitsBase<GetMotorStatus3Request,GetMotorStatus3Response,MotorStatus3> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getStatus();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::SHUTDOWN_MOTOR>: public CommandTraitsBase<ShutdownMotorRequest,ShutdownMotorResponse,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::STOP_MOTOR>: public CommandTraitsBase<StopMotorRequest,StopMotorResponse,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::TORQUE_CLOSED_LOOP_CONTROL>: public CommandTraitsBase<SetTorqueRequest,SetTorqueResponse,Feedback> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getStatus();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::SPEED_CLOSED_LOOP_CONTROL>: public CommandTraitsBase<SetVelocityRequest,SetVelocityResponse,Feedback> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getStatus();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::ABSOLUTE_POSITION_CLOSED_LOOP_CONTROL>: public CommandTraitsBase<SetPositionAbsoluteRequest,SetPositionAbsoluteResponse,Feedback> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getStatus();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_SYSTEM_OPERATING_MODE>: public CommandTraitsBase<GetControlModeRequest,GetControlModeResponse,ControlMode> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getMode();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MOTOR_POWER>: public CommandTraitsBase<GetMotorPowerRequest,GetMotorPowerResponse,float> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getPower();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::RESET_SYSTEM>: public CommandTraitsBase<ResetRequest,void,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::RELEASE_BRAKE>: public CommandTraitsBase<ReleaseBrakeRequest,ReleaseBrakeResponse,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::LOCK_BRAKE>: public CommandTraitsBase<LockBrakeRequest,LockBrakeResponse,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_SYSTEM_RUNTIME>: public CommandTraitsBase<GetSystemRuntimeRequest,GetSystemRuntimeResponse,std::chrono::milliseconds> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getRuntime();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_SYSTEM_SOFTWARE_VERSION_DATE>: public CommandTraitsBase<GetVersionDateRequest,GetVersionDateResponse,std::uint32_t> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getVersion();
+      }
+  };
+
+  template <>
+  class CommandTraits<CommandType::COMMUNICATION_INTERRUPTION_PROTECTION_TIME_SETTING>: public CommandTraitsBase<SetTimeoutRequest,SetTimeoutResponse,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::COMMUNICATION_BAUD_RATE_SETTING>: public CommandTraitsBase<SetCanBaudRateRequest,void,void> {
+  };
+
+  template <>
+  class CommandTraits<CommandType::READ_MOTOR_MODEL>: public CommandTraitsBase<GetMotorModelRequest,GetMotorModelResponse,std::string> {
+    public:
+      [[nodiscard]]
+      static Result decode(Response const& response) {
+        return response.getModel();
+      }
+  };
+
+  /**\fn call
+   * \brief
+   *    Sends the command with the given arguments over the driver and decodes its response. The types are
+   *    resolved at compile time so that there is no runtime dispatch apart from the one of the driver itself.
+   *
+   * \tparam C
+   *    The type of the command that should be sent
+   * \tparam DriverT
+   *    The type of the driver, statically dispatched if it is final or does not derive from Driver
+   * \tparam Args
+   *    The types of the arguments of the request
+   * \param[in] driver
+   *    The driver communicating with the actuator
+   * \param[in] actuator_id
+   *    The id of the actuator that the command should be sent to
+   * \param[in] args
+   *    The arguments the request should be constructed from
+   * \return
+   *    The decoded response
+  */
+  template <CommandType C, typename DriverT, typename... Args>
+  typename CommandTraits<C>::Result call(DriverT& driver, std::uint32_t const actuator_id, Args&&... args) {
+    using Traits = CommandTraits<C>;
+    typename Traits::Request const request(std::forward<Args>(args)...);
+    if constexpr (!Traits::is_reply_expected) {
+      driver.send(request, actuator_id);
+      return;
+    } else if constexpr (std::is_void_v<typename Traits::Result>) {
+      [[maybe_unused]] typename Traits::Response const response {driver.sendRecv(request, actuator_id)};
+      return;
+    } else {
+      typename Traits::Response const response {driver.sendRecv(request, actuator_id)};
+      return Traits::decode(response);
+    }
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__PROTOCOL__COMMAND_TRAITS
@@ -57,6 +57,62 @@ namespace myactuator_rmd {
     CAN_ID_SETTING = 0x79
   };
 
+  /**\fn isReadOnly
+   * \brief
+   *    Check if a command only reads from the actuator without altering its state or configuration
+   *
+   * \param[in] command
+   *    The command to be checked
+   * \return
+   *    Boolean flag signaling whether the command is a pure read
+  */
+  [[nodiscard]]
+  constexpr bool isReadOnly(CommandType const command) noexcept {
+    switch (command) {
+      case CommandType::READ_PID_PARAMETERS:
+      case CommandType::READ_ACCELERATION:
+      case CommandType::READ_MULTI_TURN_ENCODER_POSITION:
+      case CommandType::READ_MULTI_TURN_ENCODER_ORIGINAL_POSITION:
+      case CommandType::READ_MULTI_TURN_ENCODER_ZERO_OFFSET:
+      case CommandType::READ_SINGLE_TURN_ENCODER:
+      case CommandType::READ_MULTI_TURN_ANGLE:
+      case CommandType::READ_SINGLE_TURN_ANGLE:
+      case CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG:
+      case CommandType::READ_MOTOR_STATUS_2:
+      case CommandType::READ_MOTOR_STATUS_3:
+      case CommandType::READ_SYSTEM_OPERATING_MODE:
+      case CommandType::READ_MOTOR_POWER:
+      case CommandType::READ_SYSTEM_RUNTIME:
+      case CommandType::READ_SYSTEM_SOFTWARE_VERSION_DATE:
+      case CommandType::READ_MOTOR_MODEL:
+        return true;
+      default:
+        // Reading and writing the CAN id share the same command
+        return false;
+    }
+  }
+
+  /**\fn isSetpoint
+   * \brief
+   *    Check if a command sets the target of the closed-loop control of the actuator
+   *
+   * \param[in] command
+   *    The command to be checked
+   * \return
+   *    Boolean flag signaling whether the command is a set-point
+  */
+  [[nodiscard]]
+  constexpr bool isSetpoint(CommandType const command) noexcept {
+    switch (command) {
+      case CommandType::TORQUE_CLOSED_LOOP_CONTROL:
+      case CommandType::SPEED_CLOSED_LOOP_CONTROL:
+      case CommandType::ABSOLUTE_POSITION_CLOSED_LOOP_CONTROL:
+        return true;
+      default:
+        return false;
+    }
+  }
+
   // Symmetric comparison operators
   constexpr bool operator == (CommandType const& c, std::uint8_t const i) noexcept {
     return i == static_cast<std::uint8_t>(c);
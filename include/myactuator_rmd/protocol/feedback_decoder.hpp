@@ -0,0 +1,79 @@
+/**
+ * \file feedback_decoder.hpp
+ * \mainpage
+ *    Contains a decoder for batches of feedback responses writing a structure of arrays
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__PROTOCOL__FEEDBACK_DECODER
+#define MYACTUATOR_RMD__PROTOCOL__FEEDBACK_DECODER
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace myactuator_rmd {
+
+  /**\class FeedbackArrays
+   * \brief
+   *    Non-owning structure of arrays that a batch of feedback is decoded to, each array has to hold at least as
+   *    many elements as there are responses in the batch
+  */
+  class FeedbackArrays {
+    public:
+      /**\fn FeedbackArrays
+       * \brief
+       *    Class constructor
+       *
+       * \param[out] temperature_
+       *    The temperatures of the actuators in degree Celsius
+       * \param[out] current_
+       *    The currents used by the actuators in Ampere
+       * \param[out] shaft_speed_
+       *    The output shaft velocities in degree per second
+       * \param[out] shaft_angle_
+       *    The output shaft angles in degrees
+      */
+      constexpr FeedbackArrays(int* const temperature_, float* const current_, float* const shaft_speed_,
+                               float* const shaft_angle_) noexcept;
+      FeedbackArrays() = delete;
+      FeedbackArrays(FeedbackArrays const&) = default;
+      FeedbackArrays& operator = (FeedbackArrays const&) = default;
+      FeedbackArrays(FeedbackArrays&&) = default;
+      FeedbackArrays& operator = (FeedbackArrays&&) = default;
+
+      int* temperature;
+      float* current;
+      float* shaft_speed;
+      float* shaft_angle;
+  };
+
+  constexpr FeedbackArrays::FeedbackArrays(int* const temperature_, float* const current_, float* const shaft_speed_,
+                                           float* const shaft_angle_) noexcept
+  : temperature{temperature_}, current{current_}, shaft_speed{shaft_speed_}, shaft_angle{shaft_angle_} {
+    return;
+  }
+
+  /**\fn decodeFeedback
+   * \brief
+   *    Decodes a batch of feedback responses, e.g. GetMotorStatus2Response or SetTorqueResponse, at once. On x86-64
+   *    four responses are converted and scaled at a time with SSE2 while the remainder and other platforms use the
+   *    scalar decoder of the responses. The command bytes are not checked, filter the responses beforehand e.g.
+   *    with tryDecode or the FrameDecoder if the batch might contain other responses.
+   *
+   * \param[in] data
+   *    The data of the feedback responses that should be decoded
+   * \param[in] num_responses
+   *    The number of responses in the batch
+   * \param[out] feedback
+   *    The arrays that the feedback is written to
+  */
+  void decodeFeedback(std::array<std::uint8_t,8> const* data, std::size_t const num_responses,
+                      FeedbackArrays const& feedback) noexcept;
+
+}
+
+#endif // MYACTUATOR_RMD__PROTOCOL__FEEDBACK_DECODER
@@ -0,0 +1,205 @@
+/**
+ * \file frame_decoder.hpp
+ * \mainpage
+ *    Contains a decoder turning the data of any frame on the bus into the corresponding request or response
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__PROTOCOL__FRAME_DECODER
+#define MYACTUATOR_RMD__PROTOCOL__FRAME_DECODER
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\typedef AnyRequest
+   * \brief
+   *    Any request that can be sent by the driver, std::monostate for unknown commands
+  */
+  using AnyRequest = std::variant<std::monostate,
+    GetControllerGainsRequest, SetControllerGainsRequest, SetControllerGainsPersistentlyRequest,
+    GetAccelerationRequest, SetAccelerationRequest,
+    GetMultiTurnEncoderPositionRequest, GetMultiTurnEncoderOriginalPositionRequest, GetMultiTurnEncoderZeroOffsetRequest,
+    SetEncoderZeroRequest, SetCurrentPositionAsEncoderZeroRequest, GetSingleTurnEncoderPositionRequest,
+    GetMultiTurnAngleRequest, GetSingleTurnAngleRequest,
+    GetMotorStatus1Request, GetMotorStatus2Request, GetMotorStatus3Request,
+    ShutdownMotorRequest, StopMotorRequest, SetTorqueRequest, SetVelocityRequest, SetPositionAbsoluteRequest,
+    GetControlModeRequest, GetMotorPowerRequest, ResetRequest, ReleaseBrakeRequest, LockBrakeRequest,
+    GetSystemRuntimeRequest, GetVersionDateRequest, SetTimeoutRequest, SetCanBaudRateRequest, GetMotorModelRequest,
+    GetCanIdRequest, SetCanIdRequest>;
+
+  /**\typedef AnyResponse
+   * \brief
+   *    Any response that can be sent by an actuator, std::monostate for unknown commands. Replies to reading
+   *    and writing the CAN ID can not be told apart reliably and are both decoded as GetCanIdResponse.
+  */
+  using AnyResponse = std::variant<std::monostate,
+    GetControllerGainsResponse, SetControllerGainsResponse, SetControllerGainsPersistentlyResponse,
+    GetAccelerationResponse, SetAccelerationResponse,
+    GetMultiTurnEncoderPositionResponse, GetMultiTurnEncoderOriginalPositionResponse, GetMultiTurnEncoderZeroOffsetResponse,
+    SetEncoderZeroResponse, SetCurrentPositionAsEncoderZeroResponse, GetSingleTurnEncoderPositionResponse,
+    GetMultiTurnAngleResponse, GetSingleTurnAngleResponse,
+    GetMotorStatus1Response, GetMotorStatus2Response, GetMotorStatus3Response,
+    ShutdownMotorResponse, StopMotorResponse, SetTorqueResponse, SetVelocityResponse, SetPositionAbsoluteResponse,
+    GetControlModeResponse, GetMotorPowerResponse, ReleaseBrakeResponse, LockBrakeResponse,
+    GetSystemRuntimeResponse, GetVersionDateResponse, SetTimeoutResponse, GetMotorModelResponse,
+    GetCanIdResponse>;
+
+  /**\class FrameDecoder
+   * \brief
+   *    Decodes the data of any frame on the bus, e.g. for sniffers, loggers or actuator mocks, by looking up the
+   *    command byte in a table generated at compile time. The result can be inspected with std::visit.
+  */
+  class FrameDecoder {
+    public:
+      FrameDecoder() = delete;
+      FrameDecoder(FrameDecoder const&) = delete;
+      FrameDecoder& operator = (FrameDecoder const&) = delete;
+      FrameDecoder(FrameDecoder&&) = delete;
+      FrameDecoder& operator = (FrameDecoder&&) = delete;
+
+      /**\fn decodeRequest
+       * \brief
+       *    Decodes the data of a frame sent to an actuator
+       *
+       * \param[in] data
+       *    The data of the frame
+       * \return
+       *    The corresponding request or std::monostate if the command is not known
+      */
+      [[nodiscard]]
+      static AnyRequest decodeRequest(std::array<std::uint8_t,8> const& data) noexcept;
+
+      /**\fn decodeResponse
+       * \brief
+       *    Decodes the data of a frame sent by an actuator
+       *
+       * \param[in] data
+       *    The data of the frame
+       * \return
+       *    The corresponding response or std::monostate if the command is not known or has no response
+      */
+      [[nodiscard]]
+      static AnyResponse decodeResponse(std::array<std::uint8_t,8> const& data) noexcept;
+
+    protected:
+      template <typename V>
+      using Decoder = V (*)(std::array<std::uint8_t,8> const&) noexcept;
+
+      template <typename V>
+      using Table = std::array<Decoder<V>,256>;
+
+      /**\fn makeTable
+       * \brief
+       *    Generates the table mapping the command byte to the decoder of the corresponding alternative
+       *
+       * \tparam V
+       *    The variant holding all messages, its first alternative std::monostate is used for unknown commands
+       * \tparam Is
+       *    The indices of the alternatives of the variant that are messages
+       * \return
+       *    The table of decoders for each command byte
+      */
+      template <typename V, std::size_t... Is>
+      [[nodiscard]]
+      static constexpr Table<V> makeTable(std::index_sequence<Is...>) noexcept;
+
+      /**\fn decodeAs
+       * \brief
+       *    Decodes the data as the alternative of the variant with the given index
+       *
+       * \tparam V
+       *    The variant holding all messages
+       * \tparam I
+       *    The index of the alternative that the data belongs to
+       * \param[in] data
+       *    The data of the frame, its command byte has already been checked by the table lookup
+       * \return
+       *    The variant holding the decoded message
+      */
+      template <typename V, std::size_t I>
+      [[nodiscard]]
+      static V decodeAs(std::array<std::uint8_t,8> const& data) noexcept;
+
+      /**\fn decodeUnknown
+       * \brief
+       *    Decoder for command bytes that do not belong to any message
+       *
+       * \tparam V
+       *    The variant holding all messages
+       * \return
+       *    The variant holding std::monostate
+      */
+      template <typename V>
+      [[nodiscard]]
+      static V decodeUnknown(std::array<std::uint8_t,8> const&) noexcept;
+
+      /**\fn decodeCanIdRequest
+       * \brief
+       *    Decoder for the requests reading and writing the CAN ID that share a single command byte
+       *
+       * \param[in] data
+       *    The data of the frame
+       * \return
+       *    The variant holding the decoded request
+      */
+      [[nodiscard]]
+      static AnyRequest decodeCanIdRequest(std::array<std::uint8_t,8> const& data) noexcept;
+  };
+
+  template <typename V, std::size_t... Is>
+  constexpr FrameDecoder::Table<V> FrameDecoder::makeTable(std::index_sequence<Is...>) noexcept {
+    Table<V> table {};
+    for (auto& decoder: table) {
+      decoder = &decodeUnknown<V>;
+    }
+    ((table[static_cast<std::size_t>(std::variant_alternative_t<Is+1,V>::command)] = &decodeAs<V,Is+1>), ...);
+    if constexpr (std::is_same_v<V,AnyRequest>) {
+      table[static_cast<std::size_t>(CommandType::CAN_ID_SETTING)] = &decodeCanIdRequest;
+    }
+    return table;
+  }
+
+  template <typename V, std::size_t I>
+  V FrameDecoder::decodeAs(std::array<std::uint8_t,8> const& data) noexcept {
+    return V{std::in_place_index<I>, data};
+  }
+
+  template <typename V>
+  V FrameDecoder::decodeUnknown(std::array<std::uint8_t,8> const&) noexcept {
+    return V{std::in_place_index<0>};
+  }
+
+  inline AnyRequest FrameDecoder::decodeCanIdRequest(std::array<std::uint8_t,8> const& data) noexcept {
+    // The third byte is set for reading the CAN ID and cleared for writing it
+    if (data[2] != 0) {
+      return AnyRequest{std::in_place_type<GetCanIdRequest>, data};
+    }
+    return AnyRequest{std::in_place_type<SetCanIdRequest>, data};
+  }
+
+  inline AnyRequest FrameDecoder::decodeRequest(std::array<std::uint8_t,8> const& data) noexcept {
+    static constexpr auto decoders {makeTable<AnyRequest>(std::make_index_sequence<std::variant_size_v<AnyRequest>-1>{})};
+    return decoders[data[0]](data);
+  }
+
+  inline AnyResponse FrameDecoder::decodeResponse(std::array<std::uint8_t,8> const& data) noexcept {
+    static constexpr auto decoders {makeTable<AnyResponse>(std::make_index_sequence<std::variant_size_v<AnyResponse>-1>{})};
+    return decoders[data[0]](data);
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__PROTOCOL__FRAME_DECODER
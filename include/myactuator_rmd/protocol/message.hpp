@@ -11,14 +11,119 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <ratio>
 #include <stdexcept>
 #include <type_traits>
 
 
 namespace myactuator_rmd {
 
+  /**\class Field
+   * \brief
+   *    Compile-time descriptor of an integer field inside the data of a message. Its layout is checked at
+   *    compile time so that accessing it does not require any run-time checks.
+   *
+   * \tparam T
+   *    Signed or unsigned integer type of the field, its size determines the width of the field
+   * \tparam OFFSET
+   *    The index of the first byte of the field
+   * \tparam SCALE
+   *    The physical value of a single increment as a std::ratio, e.g. std::centi for a resolution of 0.01
+  */
+  template <typename T, std::size_t OFFSET, typename SCALE = std::ratio<1>>
+  class Field {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T,bool>, "Field has to be of integer type");
+    static_assert(OFFSET + sizeof(T) <= 8, "Field exceeds the data of the message");
+
+    public:
+      using type = T;
+      using scale = SCALE;
+
+      inline static constexpr std::size_t offset {OFFSET};
+      inline static constexpr std::size_t width {sizeof(T)};
+
+      /**\fn load
+       * \brief
+       *    Get the raw value of the field stored in little-endian byte order
+       * 
+       * \param[in] data
+       *    The first of the eight data bytes of the message
+       * \return
+       *    The raw value of the field
+      */
+      [[nodiscard]]
+      static constexpr T load(std::uint8_t const* data) noexcept;
+
+      /**\fn loadScaled
+       * \brief
+       *    Get the physical value of the field by scaling its raw value with its resolution
+       * 
+       * \param[in] data
+       *    The first of the eight data bytes of the message
+       * \return
+       *    The physical value of the field
+      */
+      [[nodiscard]]
+      static constexpr float loadScaled(std::uint8_t const* data) noexcept;
+
+      /**\fn store
+       * \brief
+       *    Sets the given raw value to the field in little-endian byte order
+       * 
+       * \param[out] data
+       *    The first of the eight data bytes of the message
+       * \param[in] val
+       *    The raw value that the field should be set to
+      */
+      static constexpr void store(std::uint8_t* data, T const val) noexcept;
+
+      /**\fn storeScaled
+       * \brief
+       *    Converts the physical value to the resolution of the field and sets it, truncating towards zero
+       * 
+       * \param[out] data
+       *    The first of the eight data bytes of the message
+       * \param[in] val
+       *    The physical value that the field should be set to
+      */
+      static constexpr void storeScaled(std::uint8_t* data, float const val) noexcept;
+  };
+
+  template <typename T, std::size_t OFFSET, typename SCALE>
+  constexpr T Field<T,OFFSET,SCALE>::load(std::uint8_t const* data) noexcept {
+    using Bits = std::make_unsigned_t<T>;
+    Bits bits {0};
+    for (std::size_t i = 0; i < width; ++i) {
+      bits |= static_cast<Bits>(static_cast<Bits>(data[offset + i]) << (8*i));
+    }
+    return static_cast<T>(bits);
+  }
+
+  template <typename T, std::size_t OFFSET, typename SCALE>
+  constexpr float Field<T,OFFSET,SCALE>::loadScaled(std::uint8_t const* data) noexcept {
+    constexpr float resolution {static_cast<float>(SCALE::num)/static_cast<float>(SCALE::den)};
+    return static_cast<float>(load(data))*resolution;
+  }
+
+  template <typename T, std::size_t OFFSET, typename SCALE>
+  constexpr void Field<T,OFFSET,SCALE>::store(std::uint8_t* data, T const val) noexcept {
+    auto const bits {static_cast<std::make_unsigned_t<T>>(val)};
+    for (std::size_t i = 0; i < width; ++i) {
+      data[offset + i] = static_cast<std::uint8_t>(bits >> (8*i));
+    }
+    return;
+  }
+
+  template <typename T, std::size_t OFFSET, typename SCALE>
+  constexpr void Field<T,OFFSET,SCALE>::storeScaled(std::uint8_t* data, float const val) noexcept {
+    constexpr float increments_per_unit {static_cast<float>(SCALE::den)/static_cast<float>(SCALE::num)};
+    store(data, static_cast<T>(val*increments_per_unit));
+    return;
+  }
+
   /**\class Message
    * \brief
    *    Base class for any message exchanged between the driver and the actuator
@@ -80,9 +185,79 @@ namespace myactuator_rmd {
       [[nodiscard]]
       T getAs(std::size_t const i) const;
 
+      /**\fn set
+       * \brief
+       *    Sets the given raw value to the field in little-endian byte order
+       * 
+       * \tparam F
+       *    The descriptor of the field
+       * \param[in] val
+       *    The raw value that the field should be set to
+      */
+      template <typename F>
+      constexpr void set(typename F::type const val) noexcept;
+
+      /**\fn get
+       * \brief
+       *    Get the raw value of the field stored in little-endian byte order
+       * 
+       * \tparam F
+       *    The descriptor of the field
+       * \return
+       *    The raw value of the field
+      */
+      template <typename F>
+      [[nodiscard]]
+      constexpr typename F::type get() const noexcept;
+
+      /**\fn setScaled
+       * \brief
+       *    Converts the physical value to the resolution of the field and sets it, truncating towards zero
+       * 
+       * \tparam F
+       *    The descriptor of the field
+       * \param[in] val
+       *    The physical value that the field should be set to
+      */
+      template <typename F>
+      constexpr void setScaled(float const val) noexcept;
+
+      /**\fn getScaled
+       * \brief
+       *    Get the physical value of the field by scaling its raw value with its resolution
+       * 
+       * \tparam F
+       *    The descriptor of the field
+       * \return
+       *    The physical value of the field
+      */
+      template <typename F>
+      [[nodiscard]]
+      constexpr float getScaled() const noexcept;
+
       std::array<std::uint8_t,8> data_;
   };
 
+  /**\class RawMessage
+   * \brief
+   *    Message holding arbitrary data, e.g. a copy of another message that has to outlive the original
+  */
+  class RawMessage: public Message {
+    public:
+      /**\fn RawMessage
+       * \brief
+       *    Class constructor
+       * 
+       * \param[in] data
+       *    The data to be transmitted to the CAN node
+      */
+      constexpr RawMessage(std::array<std::uint8_t,8> const& data = {}) noexcept;
+      RawMessage(RawMessage const&) = default;
+      RawMessage& operator = (RawMessage const&) = default;
+      RawMessage(RawMessage&&) = default;
+      RawMessage& operator = (RawMessage&&) = default;
+  };
+
   constexpr std::array<std::uint8_t,8> const& Message::getData() const noexcept {
     return data_;
   }
@@ -92,6 +267,11 @@ namespace myactuator_rmd {
     return;
   }
 
+  constexpr RawMessage::RawMessage(std::array<std::uint8_t,8> const& data) noexcept
+  : Message{data} {
+    return;
+  }
+
   template <typename T, typename std::enable_if_t<std::is_integral_v<T>>*>
   void Message::setAt(T const val, std::size_t const i) {
     if (i + sizeof(T)/sizeof(std::uint8_t) > data_.size()) {
@@ -111,6 +291,28 @@ namespace myactuator_rmd {
     return val;
   }
 
+  template <typename F>
+  constexpr void Message::set(typename F::type const val) noexcept {
+    F::store(data_.data(), val);
+    return;
+  }
+
+  template <typename F>
+  constexpr typename F::type Message::get() const noexcept {
+    return F::load(data_.data());
+  }
+
+  template <typename F>
+  constexpr void Message::setScaled(float const val) noexcept {
+    F::storeScaled(data_.data(), val);
+    return;
+  }
+
+  template <typename F>
+  constexpr float Message::getScaled() const noexcept {
+    return F::loadScaled(data_.data());
+  }
+
 }
 
 #endif // MYACTUATOR_RMD__PROTOCOL__MESSAGE
@@ -12,12 +12,16 @@
 
 #include <chrono>
 #include <cstdint>
+#include <ratio>
+#include <string>
 
 #include "myactuator_rmd/actuator_state/acceleration_type.hpp"
 #include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
 #include "myactuator_rmd/actuator_state/gains.hpp"
 #include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
 #include "myactuator_rmd/protocol/single_motor_message.hpp"
+#include "myactuator_rmd/exceptions.hpp"
 
 
 namespace myactuator_rmd {
@@ -59,23 +63,30 @@ namespace myactuator_rmd {
        *    True in case this is a write command, false in case it is a read command
       */
       [[nodiscard]]
-      bool isWrite() const noexcept;
+      constexpr bool isWrite() const noexcept;
 
     protected:
-      CanIdRequest() = default;
+      constexpr CanIdRequest() = default;
       CanIdRequest(CanIdRequest const&) = default;
       CanIdRequest& operator = (CanIdRequest const&) = default;
       CanIdRequest(CanIdRequest&&) = default;
       CanIdRequest& operator = (CanIdRequest&&) = default;
+
+      using ReadFlagField = Field<std::uint8_t,2>;
+      using CanIdField = Field<std::uint8_t,6>;
   };
 
+  constexpr bool CanIdRequest::isWrite() const noexcept {
+    return (get<ReadFlagField>() == 0);
+  }
+
   /**\class GetCanIdRequest
    * \brief
    *    Request for getting the CAN ID of the actuator
   */
   class GetCanIdRequest: public CanIdRequest {
     public:
-      GetCanIdRequest();
+      constexpr GetCanIdRequest() noexcept;
       GetCanIdRequest(GetCanIdRequest const&) = default;
       GetCanIdRequest& operator = (GetCanIdRequest const&) = default;
       GetCanIdRequest(GetCanIdRequest&&) = default;
@@ -83,13 +94,19 @@ namespace myactuator_rmd {
       using CanIdRequest::CanIdRequest;
   };
 
+  constexpr GetCanIdRequest::GetCanIdRequest() noexcept
+  : CanIdRequest{} {
+    set<ReadFlagField>(1);
+    return;
+  }
+
   /**\class SetCanIdRequest
    * \brief
    *    Request for setting the CAN ID of the actuator
   */
   class SetCanIdRequest: public CanIdRequest {
     public:
-      SetCanIdRequest(std::uint16_t const can_id);
+      constexpr SetCanIdRequest(std::uint16_t const can_id) noexcept;
       SetCanIdRequest(SetCanIdRequest const&) = default;
       SetCanIdRequest& operator = (SetCanIdRequest const&) = default;
       SetCanIdRequest(SetCanIdRequest&&) = default;
@@ -104,9 +121,23 @@ namespace myactuator_rmd {
        *    The CAN ID of the actuator [1, 32]
       */
       [[nodiscard]]
-      std::uint16_t getCanId() const noexcept;
+      constexpr std::uint16_t getCanId() const noexcept;
+
+    protected:
+      using ReadCanIdField = Field<std::uint8_t,7>;
   };
 
+  constexpr SetCanIdRequest::SetCanIdRequest(std::uint16_t const can_id) noexcept
+  : CanIdRequest{} {
+    set<ReadFlagField>(0);
+    set<CanIdField>(static_cast<std::uint8_t>(can_id));
+    return;
+  }
+
+  constexpr std::uint16_t SetCanIdRequest::getCanId() const noexcept {
+    return static_cast<std::uint16_t>(get<ReadCanIdField>());
+  }
+
   /**\class SetAccelerationRequest
    * \brief
    *    Request for setting the maximum acceleration/deceleration of the actuator
@@ -122,7 +153,7 @@ namespace myactuator_rmd {
        * \param[in] mode
        *    The mode of the desired acceleration/deceleration to be set
       */
-      SetAccelerationRequest(std::uint32_t const acceleration, AccelerationType const mode);
+      constexpr SetAccelerationRequest(std::uint32_t const acceleration, AccelerationType const mode);
       SetAccelerationRequest() = delete;
       SetAccelerationRequest(SetAccelerationRequest const&) = default;
       SetAccelerationRequest& operator = (SetAccelerationRequest const&) = default;
@@ -138,7 +169,7 @@ namespace myactuator_rmd {
        *    The acceleration in degree per second**2 [100, 60000]
       */
       [[nodiscard]]
-      std::uint32_t getAcceleration() const noexcept;
+      constexpr std::uint32_t getAcceleration() const noexcept;
 
       /**\fn getMode
        * \brief
@@ -148,16 +179,38 @@ namespace myactuator_rmd {
        *    The acceleration mode
       */
       [[nodiscard]]
-      AccelerationType getMode() const noexcept;
+      constexpr AccelerationType getMode() const noexcept;
+
+    protected:
+      using ModeField = Field<std::uint8_t,1>;
+      using AccelerationField = Field<std::uint32_t,4>;
   };
 
+  constexpr SetAccelerationRequest::SetAccelerationRequest(std::uint32_t const acceleration, AccelerationType const mode)
+  : SingleMotorRequest{} {
+    if ((acceleration != 0) && ((acceleration < 100) || (acceleration > 60000))) {
+      throw ValueRangeException("Acceleration value '" + std::to_string(acceleration) + "' out of range [100, 60000]");
+    }
+    set<ModeField>(static_cast<std::uint8_t>(mode));
+    set<AccelerationField>(acceleration);
+    return;
+  }
+
+  constexpr std::uint32_t SetAccelerationRequest::getAcceleration() const noexcept {
+    return get<AccelerationField>();
+  }
+
+  constexpr AccelerationType SetAccelerationRequest::getMode() const noexcept {
+    return static_cast<AccelerationType>(get<ModeField>());
+  }
+
   /**\class SetCanBaudRateRequest
    * \brief
    *    Request for setting the Baud rate of the actuator
   */
   class SetCanBaudRateRequest: public SingleMotorRequest<CommandType::COMMUNICATION_BAUD_RATE_SETTING> {
     public:
-      SetCanBaudRateRequest(CanBaudRate const baud_rate);
+      constexpr SetCanBaudRateRequest(CanBaudRate const baud_rate) noexcept;
       SetCanBaudRateRequest(SetCanBaudRateRequest const&) = default;
       SetCanBaudRateRequest& operator = (SetCanBaudRateRequest const&) = default;
       SetCanBaudRateRequest(SetCanBaudRateRequest&&) = default;
@@ -172,16 +225,29 @@ namespace myactuator_rmd {
        *    The Baud rate that the actuator should be using
       */
       [[nodiscard]]
-      CanBaudRate getBaudRate() const noexcept;
+      constexpr CanBaudRate getBaudRate() const noexcept;
+
+    protected:
+      using BaudRateField = Field<std::uint8_t,7>;
   };
 
+  constexpr SetCanBaudRateRequest::SetCanBaudRateRequest(CanBaudRate const baud_rate) noexcept
+  : SingleMotorRequest{} {
+    set<BaudRateField>(static_cast<std::uint8_t>(baud_rate));
+    return;
+  }
+
+  constexpr CanBaudRate SetCanBaudRateRequest::getBaudRate() const noexcept {
+    return static_cast<CanBaudRate>(get<BaudRateField>());
+  }
+
   /**\class SetEncoderZeroRequest
    * \brief
    *    Request for setting the encoder zero to a given value
   */
   class SetEncoderZeroRequest: public SingleMotorRequest<CommandType::WRITE_ENCODER_MULTI_TURN_VALUE_TO_ROM_AS_ZERO> {
     public:
-      SetEncoderZeroRequest(std::int32_t const encoder_offset);
+      constexpr SetEncoderZeroRequest(std::int32_t const encoder_offset) noexcept;
       SetEncoderZeroRequest(SetEncoderZeroRequest const&) = default;
       SetEncoderZeroRequest& operator = (SetEncoderZeroRequest const&) = default;
       SetEncoderZeroRequest(SetEncoderZeroRequest&&) = default;
@@ -196,9 +262,22 @@ namespace myactuator_rmd {
        *    The encoder zero value
       */
       [[nodiscard]]
-      std::int32_t getEncoderZero() const noexcept;
+      constexpr std::int32_t getEncoderZero() const noexcept;
+
+    protected:
+      using EncoderZeroField = Field<std::int32_t,4>;
   };
 
+  constexpr SetEncoderZeroRequest::SetEncoderZeroRequest(std::int32_t const encoder_offset) noexcept
+  : SingleMotorRequest{} {
+    set<EncoderZeroField>(encoder_offset);
+    return;
+  }
+
+  constexpr std::int32_t SetEncoderZeroRequest::getEncoderZero() const noexcept {
+    return get<EncoderZeroField>();
+  }
+
   /**\class SetGainsRequest
    * \brief
    *    Base class for all requests for setting controller gains
@@ -276,8 +355,7 @@ namespace myactuator_rmd {
        * \param[in] max_speed
        *    The maximum speed for the motion in degree per second
       */
-      SetPositionAbsoluteRequest(float const position, float const max_speed);
-      SetPositionAbsoluteRequest() = delete;
+      constexpr SetPositionAbsoluteRequest(float const position, float const max_speed) noexcept;
       SetPositionAbsoluteRequest(SetPositionAbsoluteRequest const&) = default;
       SetPositionAbsoluteRequest& operator = (SetPositionAbsoluteRequest const&) = default;
       SetPositionAbsoluteRequest(SetPositionAbsoluteRequest&&) = default;
@@ -292,7 +370,7 @@ namespace myactuator_rmd {
        *    The maximum speed for the motion in degree per second
       */
       [[nodiscard]]
-      float getMaxSpeed() const noexcept;
+      constexpr float getMaxSpeed() const noexcept;
 
       /**\fn getPosition
        * \brief
@@ -302,9 +380,80 @@ namespace myactuator_rmd {
        *    The position set-point in degree
       */
       [[nodiscard]]
-      float getPosition() const noexcept;
+      constexpr float getPosition() const noexcept;
+
+      /**\fn fromRaw
+       * \brief
+       *    Creates the request from set-points in the fixed-point units of the protocol without any conversion
+       * 
+       * \param[in] position
+       *    The position set-point in 0.01 degree
+       * \param[in] max_speed
+       *    The maximum speed for the motion in degree per second
+       * \return
+       *    The request with the given set-points
+      */
+      [[nodiscard]]
+      static constexpr SetPositionAbsoluteRequest fromRaw(std::int32_t const position, std::uint16_t const max_speed) noexcept;
+
+      /**\fn getMaxSpeedRaw
+       * \brief
+       *    Get the maximum speed in the fixed-point units of the protocol
+       * 
+       * \return
+       *    The maximum speed for the motion in degree per second
+      */
+      [[nodiscard]]
+      constexpr std::uint16_t getMaxSpeedRaw() const noexcept;
+
+      /**\fn getPositionRaw
+       * \brief
+       *    Get the position in the fixed-point units of the protocol
+       * 
+       * \return
+       *    The position set-point in 0.01 degree
+      */
+      [[nodiscard]]
+      constexpr std::int32_t getPositionRaw() const noexcept;
+
+    protected:
+      constexpr SetPositionAbsoluteRequest() = default;
+
+      using MaxSpeedField = Field<std::uint16_t,2>;
+      using PositionField = Field<std::int32_t,4,std::centi>;
   };
 
+  constexpr SetPositionAbsoluteRequest::SetPositionAbsoluteRequest(float const position, float const max_speed) noexcept
+  : SingleMotorRequest{} {
+    setScaled<MaxSpeedField>(max_speed);
+    setScaled<PositionField>(position);
+    return;
+  }
+
+  constexpr float SetPositionAbsoluteRequest::getMaxSpeed() const noexcept {
+    return getScaled<MaxSpeedField>();
+  }
+
+  constexpr float SetPositionAbsoluteRequest::getPosition() const noexcept {
+    return getScaled<PositionField>();
+  }
+
+  constexpr SetPositionAbsoluteRequest SetPositionAbsoluteRequest::fromRaw(std::int32_t const position,
+                                                                           std::uint16_t const max_speed) noexcept {
+    SetPositionAbsoluteRequest request {};
+    request.set<MaxSpeedField>(max_speed);
+    request.set<PositionField>(position);
+    return request;
+  }
+
+  constexpr std::uint16_t SetPositionAbsoluteRequest::getMaxSpeedRaw() const noexcept {
+    return get<MaxSpeedField>();
+  }
+
+  constexpr std::int32_t SetPositionAbsoluteRequest::getPositionRaw() const noexcept {
+    return get<PositionField>();
+  }
+
   /**\class SetTimeoutRequest
    * \brief
    *    Request for setting the communication interruption protection time setting
@@ -318,7 +467,7 @@ namespace myactuator_rmd {
        * \param[in] timeout
        *    The communication interruption protection time setting in milliseconds, 0 if this feature should be de-activated
       */
-      SetTimeoutRequest(std::chrono::milliseconds const& timeout);
+      constexpr SetTimeoutRequest(std::chrono::milliseconds const& timeout) noexcept;
       SetTimeoutRequest() = delete;
       SetTimeoutRequest(SetTimeoutRequest const&) = default;
       SetTimeoutRequest& operator = (SetTimeoutRequest const&) = default;
@@ -334,9 +483,22 @@ namespace myactuator_rmd {
        *    The communication interruption protection time to be set
       */
       [[nodiscard]]
-      std::chrono::milliseconds getTimeout() const noexcept;
+      constexpr std::chrono::milliseconds getTimeout() const noexcept;
+
+    protected:
+      using TimeoutField = Field<std::uint32_t,4>;
   };
 
+  constexpr SetTimeoutRequest::SetTimeoutRequest(std::chrono::milliseconds const& timeout) noexcept
+  : SingleMotorRequest{} {
+    set<TimeoutField>(static_cast<std::uint32_t>(timeout.count()));
+    return;
+  }
+
+  constexpr std::chrono::milliseconds SetTimeoutRequest::getTimeout() const noexcept {
+    return std::chrono::milliseconds{get<TimeoutField>()};
+  }
+
   /**\class SetTorqueRequest
    * \brief
    *    Request for setting the torque of the actuator by setting a target current
@@ -350,8 +512,7 @@ namespace myactuator_rmd {
        * \param[in] current
        *    The current set-point in Ampere
       */
-      SetTorqueRequest(float const current);
-      SetTorqueRequest() = delete;
+      constexpr SetTorqueRequest(float const current) noexcept;
       SetTorqueRequest(SetTorqueRequest const&) = default;
       SetTorqueRequest& operator = (SetTorqueRequest const&) = default;
       SetTorqueRequest(SetTorqueRequest&&) = default;
@@ -366,9 +527,56 @@ namespace myactuator_rmd {
        *    The torque current in Ampere
       */
       [[nodiscard]]
-      float getTorqueCurrent() const noexcept;
+      constexpr float getTorqueCurrent() const noexcept;
+
+      /**\fn fromRaw
+       * \brief
+       *    Creates the request from a set-point in the fixed-point units of the protocol without any conversion
+       * 
+       * \param[in] current
+       *    The current set-point in 0.01 Ampere
+       * \return
+       *    The request with the given set-point
+      */
+      [[nodiscard]]
+      static constexpr SetTorqueRequest fromRaw(std::int16_t const current) noexcept;
+
+      /**\fn getTorqueCurrentRaw
+       * \brief
+       *    Get the torque current in the fixed-point units of the protocol
+       * 
+       * \return
+       *    The torque current in 0.01 Ampere
+      */
+      [[nodiscard]]
+      constexpr std::int16_t getTorqueCurrentRaw() const noexcept;
+
+    protected:
+      constexpr SetTorqueRequest() = default;
+
+      using CurrentField = Field<std::int16_t,4,std::centi>;
   };
 
+  constexpr SetTorqueRequest::SetTorqueRequest(float const current) noexcept
+  : SingleMotorRequest{} {
+    setScaled<CurrentField>(current);
+    return;
+  }
+
+  constexpr float SetTorqueRequest::getTorqueCurrent() const noexcept {
+    return getScaled<CurrentField>();
+  }
+
+  constexpr SetTorqueRequest SetTorqueRequest::fromRaw(std::int16_t const current) noexcept {
+    SetTorqueRequest request {};
+    request.set<CurrentField>(current);
+    return request;
+  }
+
+  constexpr std::int16_t SetTorqueRequest::getTorqueCurrentRaw() const noexcept {
+    return get<CurrentField>();
+  }
+
   /**\class SetVelocityRequest
    * \brief
    *    Request for setting the velocity of the actuator
@@ -382,8 +590,7 @@ namespace myactuator_rmd {
        * \param[in] speed
        *    The velocity set-point in degree per second
       */
-      SetVelocityRequest(float const speed);
-      SetVelocityRequest() = delete;
+      constexpr SetVelocityRequest(float const speed) noexcept;
       SetVelocityRequest(SetVelocityRequest const&) = default;
       SetVelocityRequest& operator = (SetVelocityRequest const&) = default;
       SetVelocityRequest(SetVelocityRequest&&) = default;
@@ -398,9 +605,56 @@ namespace myactuator_rmd {
        *    The speed for the motion in degree per second
       */
       [[nodiscard]]
-      float getSpeed() const noexcept;
+      constexpr float getSpeed() const noexcept;
+
+      /**\fn fromRaw
+       * \brief
+       *    Creates the request from a set-point in the fixed-point units of the protocol without any conversion
+       * 
+       * \param[in] speed
+       *    The velocity set-point in 0.01 degree per second
+       * \return
+       *    The request with the given set-point
+      */
+      [[nodiscard]]
+      static constexpr SetVelocityRequest fromRaw(std::int32_t const speed) noexcept;
+
+      /**\fn getSpeedRaw
+       * \brief
+       *    Get the velocity set-point in the fixed-point units of the protocol
+       * 
+       * \return
+       *    The speed for the motion in 0.01 degree per second
+      */
+      [[nodiscard]]
+      constexpr std::int32_t getSpeedRaw() const noexcept;
+
+    protected:
+      constexpr SetVelocityRequest() = default;
+
+      using SpeedField = Field<std::int32_t,4,std::centi>;
   };
 
+  constexpr SetVelocityRequest::SetVelocityRequest(float const speed) noexcept
+  : SingleMotorRequest{} {
+    setScaled<SpeedField>(speed);
+    return;
+  }
+
+  constexpr float SetVelocityRequest::getSpeed() const noexcept {
+    return getScaled<SpeedField>();
+  }
+
+  constexpr SetVelocityRequest SetVelocityRequest::fromRaw(std::int32_t const speed) noexcept {
+    SetVelocityRequest request {};
+    request.set<SpeedField>(speed);
+    return request;
+  }
+
+  constexpr std::int32_t SetVelocityRequest::getSpeedRaw() const noexcept {
+    return get<SpeedField>();
+  }
+
   using ShutdownMotorRequest = SingleMotorRequest<CommandType::SHUTDOWN_MOTOR>;
   using StopMotorRequest = SingleMotorRequest<CommandType::STOP_MOTOR>;
 
@@ -0,0 +1,123 @@
+/**
+ * \file response_view.hpp
+ * \mainpage
+ *    Contains non-owning views decoding responses directly from a receive buffer
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__PROTOCOL__RESPONSE_VIEW
+#define MYACTUATOR_RMD__PROTOCOL__RESPONSE_VIEW
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class ResponseView
+   * \brief
+   *    Trivially copyable view of a response that decodes its fields directly from the eight data bytes of a
+   *    frame, e.g. inside the buffer filled by can::Node::readBatch, without copying them into a response first.
+   *    The view does not own the bytes and must not outlive the buffer.
+   *
+   * \tparam R
+   *    The type of the response providing the command and a static decode function, e.g. GetMotorStatus2Response
+  */
+  template <typename R>
+  class ResponseView {
+    public:
+      using Response = R;
+      using Result = decltype(R::decode(std::declval<std::uint8_t const*>()));
+
+      ResponseView() = delete;
+      ResponseView(ResponseView const&) = default;
+      ResponseView& operator = (ResponseView const&) = default;
+      ResponseView(ResponseView&&) = default;
+      ResponseView& operator = (ResponseView&&) = default;
+
+      /**\fn tryView
+       * \brief
+       *    Creates a view of the given bytes if they belong to the command of the response
+       *
+       * \param[in] data
+       *    The first of the eight data bytes of the received frame
+       * \return
+       *    The view or an empty optional if the bytes belong to another command
+      */
+      [[nodiscard]]
+      static constexpr std::optional<ResponseView> tryView(std::uint8_t const* data) noexcept;
+
+      /**\fn decode
+       * \brief
+       *    Decodes the contents of the response from the viewed bytes
+       *
+       * \return
+       *    The decoded contents, e.g. the feedback for a GetMotorStatus2Response
+      */
+      [[nodiscard]]
+      constexpr Result decode() const noexcept;
+
+      /**\fn getData
+       * \brief
+       *    Get the viewed bytes
+       *
+       * \return
+       *    The first of the eight viewed data bytes
+      */
+      [[nodiscard]]
+      constexpr std::uint8_t const* getData() const noexcept;
+
+    protected:
+      /**\fn ResponseView
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] data
+       *    The first of the eight data bytes of a frame of the command of the response
+      */
+      constexpr ResponseView(std::uint8_t const* data) noexcept;
+
+      std::uint8_t const* data_;
+  };
+
+  template <typename R>
+  constexpr ResponseView<R>::ResponseView(std::uint8_t const* data) noexcept
+  : data_{data} {
+    return;
+  }
+
+  template <typename R>
+  constexpr std::optional<ResponseView<R>> ResponseView<R>::tryView(std::uint8_t const* data) noexcept {
+    if (data[0] != R::command) {
+      return std::nullopt;
+    }
+    return ResponseView{data};
+  }
+
+  template <typename R>
+  constexpr typename ResponseView<R>::Result ResponseView<R>::decode() const noexcept {
+    return R::decode(data_);
+  }
+
+  template <typename R>
+  constexpr std::uint8_t const* ResponseView<R>::getData() const noexcept {
+    return data_;
+  }
+
+  using GetMotorStatus1ResponseView = ResponseView<GetMotorStatus1Response>;
+  using GetMotorStatus2ResponseView = ResponseView<GetMotorStatus2Response>;
+  using GetMotorStatus3ResponseView = ResponseView<GetMotorStatus3Response>;
+  using GetMultiTurnAngleResponseView = ResponseView<GetMultiTurnAngleResponse>;
+  using GetSingleTurnAngleResponseView = ResponseView<GetSingleTurnAngleResponse>;
+  using SetPositionAbsoluteResponseView = ResponseView<SetPositionAbsoluteResponse>;
+  using SetTorqueResponseView = ResponseView<SetTorqueResponse>;
+  using SetVelocityResponseView = ResponseView<SetVelocityResponse>;
+
+}
+
+#endif // MYACTUATOR_RMD__PROTOCOL__RESPONSE_VIEW
@@ -12,14 +12,19 @@
 
 #include <chrono>
 #include <cstdint>
+#include <ratio>
+#include <string>
 
 #include "myactuator_rmd/actuator_state/control_mode.hpp"
+#include "myactuator_rmd/actuator_state/error_code.hpp"
 #include "myactuator_rmd/actuator_state/feedback.hpp"
 #include "myactuator_rmd/actuator_state/gains.hpp"
 #include "myactuator_rmd/actuator_state/motor_status_1.hpp"
 #include "myactuator_rmd/actuator_state/motor_status_2.hpp"
 #include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/actuator_state/raw_feedback.hpp"
 #include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
 #include "myactuator_rmd/protocol/single_motor_message.hpp"
 
 
@@ -46,9 +51,16 @@ namespace myactuator_rmd {
        *    The CAN ID of the actuator starting at 0x240
       */
       [[nodiscard]]
-      virtual std::uint16_t getCanId() const noexcept;
+      constexpr std::uint16_t getCanId() const noexcept;
+
+    protected:
+      using CanIdField = Field<std::uint16_t,6>;
   };
 
+  constexpr std::uint16_t GetCanIdResponse::getCanId() const noexcept {
+    return get<CanIdField>();
+  }
+
   /**\class GetAccelerationResponse
    * \brief
    *    Response to request for reading the motor model
@@ -70,9 +82,16 @@ namespace myactuator_rmd {
        *    The current acceleration with a resolution of 1 dps
       */
       [[nodiscard]]
-      std::int32_t getAcceleration() const noexcept;
+      constexpr std::int32_t getAcceleration() const noexcept;
+
+    protected:
+      using AccelerationField = Field<std::int32_t,4>;
   };
 
+  constexpr std::int32_t GetAccelerationResponse::getAcceleration() const noexcept {
+    return get<AccelerationField>();
+  }
+
   /**\class GetMultiTurnAngleResponse
    * \brief
    *    Response to request for reading a multi-turn angle
@@ -94,9 +113,32 @@ namespace myactuator_rmd {
        *    The multi-turn angle with a resolution of 0.01 deg
       */
       [[nodiscard]]
-      float getAngle() const noexcept;
+      constexpr float getAngle() const noexcept;
+
+      /**\fn decode
+       * \brief
+       *    Decodes the multi-turn angle directly from the given bytes without constructing a response, e.g. from a receive buffer
+       * 
+       * \param[in] data
+       *    The first of the eight data bytes of the response
+       * \return
+       *    The multi-turn angle with a resolution of 0.01 deg
+      */
+      [[nodiscard]]
+      static constexpr float decode(std::uint8_t const* data) noexcept;
+
+    protected:
+      using AngleField = Field<std::int32_t,4,std::centi>;
   };
 
+  constexpr float GetMultiTurnAngleResponse::getAngle() const noexcept {
+    return decode(data_.data());
+  }
+
+  constexpr float GetMultiTurnAngleResponse::decode(std::uint8_t const* data) noexcept {
+    return AngleField::loadScaled(data);
+  }
+
   /**\class GetMultiTurnEncoderPositionResponse
    * \brief
    *    Response to request for reading a multi-turn encoder position
@@ -122,13 +164,15 @@ namespace myactuator_rmd {
        *    The current encoder position
       */
       [[nodiscard]]
-      std::int32_t getPosition() const noexcept;
+      constexpr std::int32_t getPosition() const noexcept;
+
+    protected:
+      using PositionField = Field<std::int32_t,4>;
   };
 
   template <CommandType C>
-  std::int32_t MultiTurnEncoderPositionResponse<C>::getPosition() const noexcept {
-    auto const encoder_position {this->template getAs<std::int32_t>(4)};
-    return encoder_position;
+  constexpr std::int32_t MultiTurnEncoderPositionResponse<C>::getPosition() const noexcept {
+    return this->template get<PositionField>();
   }
 
   using GetMultiTurnEncoderPositionResponse = MultiTurnEncoderPositionResponse<CommandType::READ_MULTI_TURN_ENCODER_POSITION>;
@@ -156,9 +200,33 @@ namespace myactuator_rmd {
        *    The single-turn angle with a resolution of 0.01 deg
       */
       [[nodiscard]]
-      float getAngle() const noexcept;
+      constexpr float getAngle() const noexcept;
+
+      /**\fn decode
+       * \brief
+       *    Decodes the single-turn angle directly from the given bytes without constructing a response, e.g. from a receive buffer
+       * 
+       * \param[in] data
+       *    The first of the eight data bytes of the response
+       * \return
+       *    The single-turn angle with a resolution of 0.01 deg
+      */
+      [[nodiscard]]
+      static constexpr float decode(std::uint8_t const* data) noexcept;
+
+    protected:
+      using AngleField = Field<std::int16_t,6,std::centi>;
   };
 
+  constexpr float GetSingleTurnAngleResponse::getAngle() const noexcept {
+    return decode(data_.data());
+  }
+
+  constexpr float GetSingleTurnAngleResponse::decode(std::uint8_t const* data) noexcept {
+    // This does not seem to give the correct results at least with my motor
+    return AngleField::loadScaled(data);
+  }
+
   /**\class GetSingleTurnEncoderPositionResponse
    * \brief
    *    Response to request for reading a single-turn encoder position
@@ -180,7 +248,7 @@ namespace myactuator_rmd {
        *    The current encoder position
       */
       [[nodiscard]]
-      std::int16_t getPosition() const noexcept;
+      constexpr std::int16_t getPosition() const noexcept;
 
       /**\fn getRawPosition
        * \brief
@@ -190,7 +258,7 @@ namespace myactuator_rmd {
        *    The current raw encoder position
       */
       [[nodiscard]]
-      std::int16_t getRawPosition() const noexcept;
+      constexpr std::int16_t getRawPosition() const noexcept;
 
       /**\fn getOffset
        * \brief
@@ -200,9 +268,26 @@ namespace myactuator_rmd {
        *    The current encoder position offset
       */
       [[nodiscard]]
-      std::int16_t getOffset() const noexcept;
+      constexpr std::int16_t getOffset() const noexcept;
+
+    protected:
+      using PositionField = Field<std::int16_t,2>;
+      using RawPositionField = Field<std::int16_t,4>;
+      using OffsetField = Field<std::int16_t,6>;
   };
 
+  constexpr std::int16_t GetSingleTurnEncoderPositionResponse::getPosition() const noexcept {
+    return get<PositionField>();
+  }
+
+  constexpr std::int16_t GetSingleTurnEncoderPositionResponse::getRawPosition() const noexcept {
+    return get<RawPositionField>();
+  }
+
+  constexpr std::int16_t GetSingleTurnEncoderPositionResponse::getOffset() const noexcept {
+    return get<OffsetField>();
+  }
+
   using LockBrakeResponse = SingleMotorResponse<CommandType::LOCK_BRAKE>;
   using ReleaseBrakeResponse = SingleMotorResponse<CommandType::RELEASE_BRAKE>;
 
@@ -231,23 +316,94 @@ namespace myactuator_rmd {
        *    Feedback from the actuator
       */
       [[nodiscard]]
-      Feedback getStatus() const noexcept;
+      constexpr Feedback getStatus() const noexcept;
+
+      /**\fn decode
+       * \brief
+       *    Decodes the feedback directly from the given bytes without constructing a response, e.g. from a receive buffer
+       * 
+       * \param[in] data
+       *    The first of the eight data bytes of the response
+       * \return
+       *    Feedback from the actuator
+      */
+      [[nodiscard]]
+      static constexpr Feedback decode(std::uint8_t const* data) noexcept;
+
+      /**\fn getStatusRaw
+       * \brief
+       *    Get the feedback in the fixed-point units of the protocol without any conversion to floating point
+       * 
+       * \return
+       *    Raw feedback from the actuator
+      */
+      [[nodiscard]]
+      constexpr RawFeedback getStatusRaw() const noexcept;
+
+      /**\fn decodeRaw
+       * \brief
+       *    Decodes the raw feedback directly from the given bytes without constructing a response
+       * 
+       * \param[in] data
+       *    The first of the eight data bytes of the response
+       * \return
+       *    Raw feedback from the actuator
+      */
+      [[nodiscard]]
+      static constexpr RawFeedback decodeRaw(std::uint8_t const* data) noexcept;
+
+    protected:
+      using TemperatureField = Field<std::int8_t,1>;
+      using CurrentField = Field<std::int16_t,2,std::centi>;
+      using ShaftSpeedField = Field<std::int16_t,4>;
+      using ShaftAngleField = Field<std::int16_t,6>;
   };
 
   template <CommandType C>
-  Feedback FeedbackResponse<C>::getStatus() const noexcept {
-    auto const temperature {static_cast<int>(this->template getAs<std::int8_t>(1))};
-    auto const current {static_cast<float>(this->template getAs<std::int16_t>(2))*0.01f};
-    auto const shaft_speed {static_cast<float>(this->template getAs<std::int16_t>(4))};
-    auto const shaft_angle {static_cast<float>(this->template getAs<std::int16_t>(6))};
+  constexpr Feedback FeedbackResponse<C>::getStatus() const noexcept {
+    return decode(this->data_.data());
+  }
+
+  template <CommandType C>
+  constexpr Feedback FeedbackResponse<C>::decode(std::uint8_t const* data) noexcept {
+    auto const temperature {static_cast<int>(TemperatureField::load(data))};
+    auto const current {CurrentField::loadScaled(data)};
+    auto const shaft_speed {ShaftSpeedField::loadScaled(data)};
+    auto const shaft_angle {ShaftAngleField::loadScaled(data)};
     return Feedback{temperature, current, shaft_speed, shaft_angle};
   }
 
+  template <CommandType C>
+  constexpr RawFeedback FeedbackResponse<C>::getStatusRaw() const noexcept {
+    return decodeRaw(this->data_.data());
+  }
+
+  template <CommandType C>
+  constexpr RawFeedback FeedbackResponse<C>::decodeRaw(std::uint8_t const* data) noexcept {
+    return RawFeedback{TemperatureField::load(data), CurrentField::load(data), ShaftSpeedField::load(data),
+                       ShaftAngleField::load(data)};
+  }
+
   using GetMotorStatus2Response = FeedbackResponse<CommandType::READ_MOTOR_STATUS_2>;
   using SetPositionAbsoluteResponse = FeedbackResponse<CommandType::ABSOLUTE_POSITION_CLOSED_LOOP_CONTROL>;
   using SetTorqueResponse = FeedbackResponse<CommandType::TORQUE_CLOSED_LOOP_CONTROL>;
   using SetVelocityResponse = FeedbackResponse<CommandType::SPEED_CLOSED_LOOP_CONTROL>;
 
+  /**\fn isFeedbackResponse
+   * \brief
+   *    Check whether the response to a command contains a feedback
+   *
+   * \param[in] command
+   *    The command byte of the response
+   * \return
+   *    Boolean flag signaling whether the response has the layout of a FeedbackResponse
+  */
+  [[nodiscard]]
+  constexpr bool isFeedbackResponse(std::uint8_t const command) noexcept {
+    return (command == GetMotorStatus2Response::command) || (command == SetPositionAbsoluteResponse::command) ||
+           (command == SetTorqueResponse::command) || (command == SetVelocityResponse::command);
+  }
+
   /**\class GainsResponse
    * \brief
    *    Base class for all responses with controller gains
@@ -364,9 +520,16 @@ namespace myactuator_rmd {
        *    The current motor power in Watt with a resolution of 0.1
       */
       [[nodiscard]]
-      float getPower() const noexcept;
+      constexpr float getPower() const noexcept;
+
+    protected:
+      using PowerField = Field<std::uint16_t,6,std::deci>;
   };
 
+  constexpr float GetMotorPowerResponse::getPower() const noexcept {
+    return getScaled<PowerField>();
+  }
+
   /**\class GetMotorStatus1Response
    * \brief
    *    Response to request for getting motor status
@@ -388,9 +551,39 @@ namespace myactuator_rmd {
        *    Motor status of the actuator
       */
       [[nodiscard]]
-      MotorStatus1 getStatus() const noexcept;
+      constexpr MotorStatus1 getStatus() const noexcept;
+
+      /**\fn decode
+       * \brief
+       *    Decodes the motor status directly from the given bytes without constructing a response, e.g. from a receive buffer
+       * 
+       * \param[in] data
+       *    The first of the eight data bytes of the response
+       * \return
+       *    Motor status of the actuator
+      */
+      [[nodiscard]]
+      static constexpr MotorStatus1 decode(std::uint8_t const* data) noexcept;
+
+    protected:
+      using TemperatureField = Field<std::int8_t,1>;
+      using BrakeField = Field<std::uint8_t,3>;
+      using VoltageField = Field<std::uint16_t,4,std::deci>;
+      using ErrorCodeField = Field<std::uint16_t,6>;
   };
 
+  constexpr MotorStatus1 GetMotorStatus1Response::getStatus() const noexcept {
+    return decode(data_.data());
+  }
+
+  constexpr MotorStatus1 GetMotorStatus1Response::decode(std::uint8_t const* data) noexcept {
+    auto const temperature {static_cast<int>(TemperatureField::load(data))};
+    auto const is_brake_released {static_cast<bool>(BrakeField::load(data))};
+    auto const voltage {VoltageField::loadScaled(data)};
+    auto const error_code {static_cast<ErrorCode>(ErrorCodeField::load(data))};
+    return MotorStatus1{temperature, is_brake_released, voltage, error_code};
+  }
+
   /**\class GetMotorStatus3Response
    * \brief
    *    Response to request for getting motor status
@@ -412,9 +605,39 @@ namespace myactuator_rmd {
        *    Motor status of the actuator
       */
       [[nodiscard]]
-      MotorStatus3 getStatus() const noexcept;
+      constexpr MotorStatus3 getStatus() const noexcept;
+
+      /**\fn decode
+       * \brief
+       *    Decodes the motor status directly from the given bytes without constructing a response, e.g. from a receive buffer
+       * 
+       * \param[in] data
+       *    The first of the eight data bytes of the response
+       * \return
+       *    Motor status of the actuator
+      */
+      [[nodiscard]]
+      static constexpr MotorStatus3 decode(std::uint8_t const* data) noexcept;
+
+    protected:
+      using TemperatureField = Field<std::int8_t,1>;
+      using CurrentPhaseAField = Field<std::int16_t,2,std::centi>;
+      using CurrentPhaseBField = Field<std::int16_t,4,std::centi>;
+      using CurrentPhaseCField = Field<std::int16_t,6,std::centi>;
   };
 
+  constexpr MotorStatus3 GetMotorStatus3Response::getStatus() const noexcept {
+    return decode(data_.data());
+  }
+
+  constexpr MotorStatus3 GetMotorStatus3Response::decode(std::uint8_t const* data) noexcept {
+    auto const temperature {static_cast<int>(TemperatureField::load(data))};
+    auto const current_phase_a {CurrentPhaseAField::loadScaled(data)};
+    auto const current_phase_b {CurrentPhaseBField::loadScaled(data)};
+    auto const current_phase_c {CurrentPhaseCField::loadScaled(data)};
+    return MotorStatus3{temperature, current_phase_a, current_phase_b, current_phase_c};
+  }
+
   /**\class GetSystemRuntimeResponse
    * \brief
    *    Response to request for getting the actuator's runtime
@@ -436,9 +659,16 @@ namespace myactuator_rmd {
        *    The actuators runtime in milliseconds
       */
       [[nodiscard]]
-      std::chrono::milliseconds getRuntime() const noexcept;
+      constexpr std::chrono::milliseconds getRuntime() const noexcept;
+
+    protected:
+      using RuntimeField = Field<std::uint32_t,4>;
   };
 
+  constexpr std::chrono::milliseconds GetSystemRuntimeResponse::getRuntime() const noexcept {
+    return std::chrono::milliseconds{get<RuntimeField>()};
+  }
+
   /**\class GetVersionDateResponse
    * \brief
    *    Response to request for getting the actuator's version date
@@ -460,9 +690,16 @@ namespace myactuator_rmd {
        *    The version date as an integer number
       */
       [[nodiscard]]
-      std::uint32_t getVersion() const noexcept;
+      constexpr std::uint32_t getVersion() const noexcept;
+
+    protected:
+      using VersionField = Field<std::uint32_t,4>;
   };
 
+  constexpr std::uint32_t GetVersionDateResponse::getVersion() const noexcept {
+    return get<VersionField>();
+  }
+
   using SetAccelerationResponse = SingleMotorResponse<CommandType::WRITE_ACCELERATION_TO_RAM_AND_ROM>;
   using SetCanIdResponse = SingleMotorResponse<CommandType::CAN_ID_SETTING>;
 
@@ -487,9 +724,16 @@ namespace myactuator_rmd {
        *    The encoder zero value
       */
       [[nodiscard]]
-      std::int32_t getEncoderZero() const noexcept;
+      constexpr std::int32_t getEncoderZero() const noexcept;
+
+    protected:
+      using EncoderZeroField = Field<std::int32_t,4>;
   };
 
+  constexpr std::int32_t SetCurrentPositionAsEncoderZeroResponse::getEncoderZero() const noexcept {
+    return get<EncoderZeroField>();
+  }
+
   using SetEncoderZeroResponse = SingleMotorRequest<CommandType::WRITE_ENCODER_MULTI_TURN_VALUE_TO_ROM_AS_ZERO>;
   using SetTimeoutResponse = SingleMotorResponse<CommandType::COMMUNICATION_INTERRUPTION_PROTECTION_TIME_SETTING>;
   using ShutdownMotorResponse = SingleMotorResponse<CommandType::SHUTDOWN_MOTOR>;
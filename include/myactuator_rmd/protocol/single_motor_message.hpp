@@ -13,7 +13,9 @@
 #include <array>
 #include <cstdint>
 #include <ios>
+#include <optional>
 #include <sstream>
+#include <type_traits>
 
 #include "myactuator_rmd/protocol/command_type.hpp"
 #include "myactuator_rmd/protocol/message.hpp"
@@ -31,6 +33,9 @@ namespace myactuator_rmd {
   */
   template <CommandType C>
   class SingleMotorMessage: public Message {
+    public:
+      inline static constexpr CommandType command {C};
+
     protected:
       /**\fn SingleMotorMessage
        * \brief
@@ -45,19 +50,35 @@ namespace myactuator_rmd {
       SingleMotorMessage& operator = (SingleMotorMessage const&) = default;
       SingleMotorMessage(SingleMotorMessage&&) = default;
       SingleMotorMessage& operator = (SingleMotorMessage&&) = default;
+
+      /**\fn throwUnexpectedCommand
+       * \brief
+       *    Throws a protocol exception for a message of an unexpected command, kept out of the constructor
+       *    so that the latter can be evaluated at compile time
+       * 
+       * \param[in] command
+       *    The command byte of the unexpected message
+      */
+      [[noreturn]]
+      static void throwUnexpectedCommand(std::uint8_t const command);
   };
 
   template <CommandType C>
   constexpr SingleMotorMessage<C>::SingleMotorMessage(std::array<std::uint8_t,8> const& data)
   : Message{data} {
     if (data[0] != C) {
-      std::stringstream ss {};
-      ss << std::showbase << std::hex << static_cast<std::uint16_t>(data[0]);
-      throw ProtocolException("Unexpected response '" + ss.str() + "'");
+      throwUnexpectedCommand(data[0]);
     }
     return;
   }
 
+  template <CommandType C>
+  void SingleMotorMessage<C>::throwUnexpectedCommand(std::uint8_t const command) {
+    std::stringstream ss {};
+    ss << std::showbase << std::hex << static_cast<std::uint16_t>(command);
+    throw ProtocolException("Unexpected response '" + ss.str() + "'");
+  }
+
   template <CommandType C>
   constexpr SingleMotorMessage<C>::SingleMotorMessage() noexcept
   : Message{} {
@@ -113,6 +134,29 @@ namespace myactuator_rmd {
     return;
   }
 
+  /**\fn tryDecode
+   * \brief
+   *    Decodes the given bytes into a message of the given type without throwing for messages of other
+   *    commands, e.g. interleaved replies of other requests on a shared bus
+   *
+   * \tparam M
+   *    The type of the single motor message to be decoded, e.g. GetMotorStatus2Response
+   * \param[in] data
+   *    The received bytes
+   * \return
+   *    The decoded message or an empty optional if the bytes belong to another command
+  */
+  template <typename M>
+  [[nodiscard]]
+  constexpr std::optional<M> tryDecode(std::array<std::uint8_t,8> const& data) noexcept {
+    static_assert(std::is_base_of_v<SingleMotorMessage<M::command>,M>, "Can only decode single motor messages");
+    if (data[0] != M::command) {
+      return std::nullopt;
+    }
+    // The command was checked above so that the constructor can not throw
+    return M{data};
+  }
+
 }
 
 #endif // MYACTUATOR_RMD__PROTOCOL__SINGLE_MOTOR_MESSAGE
@@ -0,0 +1,171 @@
+/**
+ * \file cyclic_executor.hpp
+ * \mainpage
+ *    Contains an executor that runs a control loop at a fixed period
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__REALTIME__CYCLIC_EXECUTOR
+#define MYACTUATOR_RMD__REALTIME__CYCLIC_EXECUTOR
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <optional>
+#include <thread>
+
+
+namespace myactuator_rmd {
+
+  /**\class ExecutorConfiguration
+   * \brief
+   *    Configuration of the thread running a cyclic executor
+  */
+  class ExecutorConfiguration {
+    public:
+      /**\fn ExecutorConfiguration
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] period_
+       *    The period the callback should be run at
+       * \param[in] priority_
+       *    The SCHED_FIFO priority of the thread [1, 99], default scheduling if not given
+       * \param[in] cpu_
+       *    The CPU the thread should be pinned to, not pinned if not given
+       * \param[in] is_lock_memory_
+       *    Lock all current and future pages of the process into memory, this affects the entire process
+       * \param[in] is_prefault_stack_
+       *    Touch the stack of the thread before starting so that no page faults occur during the first cycles
+      */
+      constexpr ExecutorConfiguration(std::chrono::nanoseconds const& period_, std::optional<int> const& priority_ = std::nullopt,
+                                      std::optional<int> const& cpu_ = std::nullopt, bool const is_lock_memory_ = false,
+                                      bool const is_prefault_stack_ = true) noexcept;
+      ExecutorConfiguration() = delete;
+      ExecutorConfiguration(ExecutorConfiguration const&) = default;
+      ExecutorConfiguration& operator = (ExecutorConfiguration const&) = default;
+      ExecutorConfiguration(ExecutorConfiguration&&) = default;
+      ExecutorConfiguration& operator = (ExecutorConfiguration&&) = default;
+
+      std::chrono::nanoseconds period;
+      std::optional<int> priority;
+      std::optional<int> cpu;
+      bool is_lock_memory;
+      bool is_prefault_stack;
+  };
+
+  constexpr ExecutorConfiguration::ExecutorConfiguration(std::chrono::nanoseconds const& period_, std::optional<int> const& priority_,
+                                                         std::optional<int> const& cpu_, bool const is_lock_memory_,
+                                                         bool const is_prefault_stack_) noexcept
+  : period{period_}, priority{priority_}, cpu{cpu_}, is_lock_memory{is_lock_memory_}, is_prefault_stack{is_prefault_stack_} {
+    return;
+  }
+
+  /**\class ExecutorStatistics
+   * \brief
+   *    Timing statistics of a cyclic executor
+  */
+  class ExecutorStatistics {
+    public:
+      std::uint64_t num_cycles; // Number of times the callback was run
+      std::uint64_t num_deadline_misses; // Number of cycles whose callback did not finish within its period
+      std::uint64_t num_skipped_cycles; // Number of cycles that were skipped due to overruns
+      std::uint64_t num_errors; // Number of times the callback threw an exception
+      std::chrono::nanoseconds total_wake_up_latency; // Sum of the delays between the scheduled and actual wake-up
+      std::chrono::nanoseconds max_wake_up_latency; // Largest delay between the scheduled and actual wake-up
+      std::chrono::nanoseconds total_execution_time; // Sum of the durations of the callback
+      std::chrono::nanoseconds max_execution_time; // Longest duration of the callback
+  };
+
+  /**\class CyclicExecutor
+   * \brief
+   *    Runs a callback, e.g. sending set-points to the actuators, at a fixed period from a dedicated thread.
+   *    The thread sleeps until absolute wake-up times so that the period does not drift, and can be run with
+   *    real-time scheduling, pinned to a CPU and with locked and pre-faulted memory. Cycles that overrun their
+   *    period are counted as deadline misses and the following periods that have already passed are skipped
+   *    instead of being run in a burst.
+  */
+  class CyclicExecutor {
+    public:
+      /**\fn CyclicExecutor
+       * \brief
+       *    Class constructor, configures and starts the thread running the callback
+       *
+       * \param[in] callback
+       *    The function that should be run each cycle
+       * \param[in] configuration
+       *    The period and the real-time configuration of the thread
+       * \throws
+       *    std::system_error if the thread could not be configured, e.g. due to missing privileges
+      */
+      CyclicExecutor(std::function<void()> const& callback, ExecutorConfiguration const& configuration);
+      CyclicExecutor() = delete;
+      CyclicExecutor(CyclicExecutor const&) = delete;
+      CyclicExecutor& operator = (CyclicExecutor const&) = delete;
+      CyclicExecutor(CyclicExecutor&&) = delete;
+      CyclicExecutor& operator = (CyclicExecutor&&) = delete;
+      ~CyclicExecutor();
+
+      /**\fn stop
+       * \brief
+       *    Stops running the callback after the current cycle, can be called from any thread including the callback
+      */
+      void stop() noexcept;
+
+      /**\fn isRunning
+       * \brief
+       *    Check whether the callback is still run periodically
+       *
+       * \return
+       *    Boolean flag signaling whether the executor is running
+      */
+      [[nodiscard]]
+      bool isRunning() const noexcept;
+
+      /**\fn getStatistics
+       * \brief
+       *    Get the timing statistics, can be called from any thread
+       *
+       * \return
+       *    A snapshot of the timing statistics
+      */
+      [[nodiscard]]
+      ExecutorStatistics getStatistics() const noexcept;
+
+    protected:
+      /**\fn configure
+       * \brief
+       *    Applies the real-time configuration to the calling thread
+      */
+      void configure() const;
+
+      /**\fn run
+       * \brief
+       *    Main loop of the thread running the callback
+       *
+       * \param[in] is_configured
+       *    Set once the thread is configured or configuring it failed
+      */
+      void run(std::promise<void> is_configured) noexcept;
+
+      std::function<void()> callback_;
+      ExecutorConfiguration configuration_;
+      std::atomic<std::uint64_t> num_cycles_;
+      std::atomic<std::uint64_t> num_deadline_misses_;
+      std::atomic<std::uint64_t> num_skipped_cycles_;
+      std::atomic<std::uint64_t> num_errors_;
+      std::atomic<std::int64_t> total_wake_up_latency_ns_;
+      std::atomic<std::int64_t> max_wake_up_latency_ns_;
+      std::atomic<std::int64_t> total_execution_time_ns_;
+      std::atomic<std::int64_t> max_execution_time_ns_;
+      std::atomic<bool> is_running_;
+      std::thread thread_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__REALTIME__CYCLIC_EXECUTOR
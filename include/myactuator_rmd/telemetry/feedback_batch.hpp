@@ -0,0 +1,269 @@
+/**
+ * \file feedback_batch.hpp
+ * \mainpage
+ *    Contains a structure of arrays holding the latest feedback of several actuators
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TELEMETRY__FEEDBACK_BATCH
+#define MYACTUATOR_RMD__TELEMETRY__FEEDBACK_BATCH
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <vector>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class FeedbackBatch
+   * \brief
+   *    Latest feedback of several actuators stored as a structure of arrays, e.g. for evaluating a control law
+   *    for all joints at once. Each actuator is assigned the slot of its position in the list of actuator ids.
+   *    The arrays are aligned to cache lines and padded with invalid slots to a multiple of the cache line size
+   *    so that vectorised loops may process the full capacity without a scalar remainder.
+  */
+  class FeedbackBatch {
+    public:
+      /**\fn FeedbackBatch
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] actuator_ids
+       *    The ids of the actuators in the order of their slots
+      */
+      FeedbackBatch(std::vector<std::uint32_t> const& actuator_ids);
+      FeedbackBatch() = delete;
+      FeedbackBatch(FeedbackBatch const&) = delete;
+      FeedbackBatch& operator = (FeedbackBatch const&) = delete;
+      FeedbackBatch(FeedbackBatch&&) = default;
+      FeedbackBatch& operator = (FeedbackBatch&&) = default;
+
+      /**\fn update
+       * \brief
+       *    Stores a response of an actuator in its slot if it contains a feedback, e.g. a GetMotorStatus2Response
+       *    or a SetTorqueResponse
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator that the response was received from
+       * \param[in] response
+       *    The response bytes
+       * \param[in] timestamp
+       *    The time the response was received
+       * \return
+       *    Boolean flag signaling whether the response was stored or ignored as it belongs to another actuator or
+       *    does not contain a feedback
+      */
+      bool update(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                  std::chrono::steady_clock::time_point const& timestamp = std::chrono::steady_clock::now()) noexcept;
+
+      /**\fn update
+       * \brief
+       *    Stores a response of an actuator in its slot if it contains a feedback, decoding it directly from the
+       *    given bytes, e.g. the data of a frame received with can::Node::readBatch
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator that the response was received from
+       * \param[in] response
+       *    The first of the eight response bytes
+       * \param[in] timestamp
+       *    The time the response was received
+       * \return
+       *    Boolean flag signaling whether the response was stored or ignored as it belongs to another actuator or
+       *    does not contain a feedback
+      */
+      bool update(std::uint32_t const actuator_id, std::uint8_t const* response,
+                  std::chrono::steady_clock::time_point const& timestamp = std::chrono::steady_clock::now()) noexcept;
+
+      /**\fn invalidate
+       * \brief
+       *    Marks all slots as invalid, e.g. before the feedback of the next control cycle is received
+      */
+      void invalidate() noexcept;
+
+      /**\fn invalidateOlderThan
+       * \brief
+       *    Marks all slots that were not updated for longer than the given age as invalid
+       *
+       * \param[in] max_age
+       *    The maximum age of a valid slot
+       * \param[in] now
+       *    The current time
+      */
+      void invalidateOlderThan(std::chrono::steady_clock::duration const& max_age,
+                               std::chrono::steady_clock::time_point const& now = std::chrono::steady_clock::now()) noexcept;
+
+      /**\fn isComplete
+       * \brief
+       *    Check whether all slots hold a valid feedback
+       *
+       * \return
+       *    Boolean flag signaling whether the feedback of all actuators is valid
+      */
+      [[nodiscard]]
+      bool isComplete() const noexcept;
+
+      /**\fn getIndex
+       * \brief
+       *    Get the slot of an actuator
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    The index of its slot or an empty optional if the actuator is not part of the batch
+      */
+      [[nodiscard]]
+      std::optional<std::size_t> getIndex(std::uint32_t const actuator_id) const noexcept;
+
+      /**\fn getFeedback
+       * \brief
+       *    Get the feedback stored in a slot
+       *
+       * \param[in] index
+       *    The index of the slot
+       * \return
+       *    The feedback stored in the slot, only meaningful if the slot is valid
+      */
+      [[nodiscard]]
+      Feedback getFeedback(std::size_t const index) const noexcept;
+
+      /**\fn getAge
+       * \brief
+       *    Get the time since the feedback stored in a slot was received
+       *
+       * \param[in] index
+       *    The index of the slot
+       * \param[in] now
+       *    The current time
+       * \return
+       *    The age of the feedback, only meaningful if the slot is valid
+      */
+      [[nodiscard]]
+      std::chrono::steady_clock::duration getAge(std::size_t const index,
+                                                 std::chrono::steady_clock::time_point const& now = std::chrono::steady_clock::now()) const noexcept;
+
+      /**\fn size
+       * \brief
+       *    Get the number of actuators in the batch
+       *
+       * \return
+       *    The number of slots holding an actuator
+      */
+      [[nodiscard]]
+      std::size_t size() const noexcept;
+
+      /**\fn getCapacity
+       * \brief
+       *    Get the length of the arrays including the padding
+       *
+       * \return
+       *    The number of elements of each array, a multiple of the cache line size
+      */
+      [[nodiscard]]
+      std::size_t getCapacity() const noexcept;
+
+      /**\fn getActuatorIds
+       * \brief
+       *    Get the ids of the actuators in the order of their slots
+       *
+       * \return
+       *    The ids of the actuators
+      */
+      [[nodiscard]]
+      std::vector<std::uint32_t> const& getActuatorIds() const noexcept;
+
+      /**\fn getTemperature
+       * \brief
+       *    Get the array of temperatures
+       *
+       * \return
+       *    The temperatures of the actuators in degree Celsius
+      */
+      [[nodiscard]]
+      int const* getTemperature() const noexcept;
+
+      /**\fn getCurrent
+       * \brief
+       *    Get the array of currents
+       *
+       * \return
+       *    The currents used by the actuators in Ampere
+      */
+      [[nodiscard]]
+      float const* getCurrent() const noexcept;
+
+      /**\fn getShaftSpeed
+       * \brief
+       *    Get the array of output shaft velocities
+       *
+       * \return
+       *    The output shaft velocities in degree per second
+      */
+      [[nodiscard]]
+      float const* getShaftSpeed() const noexcept;
+
+      /**\fn getShaftAngle
+       * \brief
+       *    Get the array of output shaft angles
+       *
+       * \return
+       *    The output shaft angles in degrees
+      */
+      [[nodiscard]]
+      float const* getShaftAngle() const noexcept;
+
+      /**\fn getValid
+       * \brief
+       *    Get the array of validity flags
+       *
+       * \return
+       *    The validity of each slot, non-zero if the slot holds a feedback that was not invalidated since
+      */
+      [[nodiscard]]
+      std::uint8_t const* getValid() const noexcept;
+
+      /**\fn getTimestamps
+       * \brief
+       *    Get the array of receive times
+       *
+       * \return
+       *    The times the feedback stored in each slot was received
+      */
+      [[nodiscard]]
+      std::chrono::steady_clock::time_point const* getTimestamps() const noexcept;
+
+      // Size of a cache line that all arrays are aligned and padded to
+      static constexpr std::size_t alignment {64};
+
+    protected:
+      /**\class AlignedDeleter
+       * \brief
+       *    Deleter releasing the memory of the arrays that was allocated with the given alignment
+      */
+      class AlignedDeleter {
+        public:
+          void operator() (std::byte* const storage) const noexcept;
+      };
+
+      std::vector<std::uint32_t> actuator_ids_;
+      std::size_t capacity_;
+      std::unique_ptr<std::byte[],AlignedDeleter> storage_;
+      int* temperature_;
+      float* current_;
+      float* shaft_speed_;
+      float* shaft_angle_;
+      std::chrono::steady_clock::time_point* timestamps_;
+      std::uint8_t* valid_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__TELEMETRY__FEEDBACK_BATCH
@@ -0,0 +1,150 @@
+/**
+ * \file feedback_ring.hpp
+ * \mainpage
+ *    Contains lock-free ring buffers holding the recent feedback of each actuator
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TELEMETRY__FEEDBACK_RING
+#define MYACTUATOR_RMD__TELEMETRY__FEEDBACK_RING
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/driver/response_listener.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+#include "myactuator_rmd/telemetry/stamped_response.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class StampedFeedback
+   * \brief
+   *    Feedback of an actuator together with the time it was received
+  */
+  class StampedFeedback {
+    public:
+      /**\fn StampedFeedback
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] feedback_
+       *    The feedback of the actuator
+       * \param[in] timestamp_
+       *    The time the feedback was received
+      */
+      StampedFeedback(Feedback const& feedback_ = {}, std::chrono::steady_clock::time_point const& timestamp_ = {}) noexcept;
+      StampedFeedback(StampedFeedback const&) = default;
+      StampedFeedback& operator = (StampedFeedback const&) = default;
+      StampedFeedback(StampedFeedback&&) = default;
+      StampedFeedback& operator = (StampedFeedback&&) = default;
+
+      Feedback feedback;
+      std::chrono::steady_clock::time_point timestamp;
+  };
+
+  /**\class FeedbackRing
+   * \brief
+   *    Listener holding the most recent feedback of each actuator in a fixed-capacity ring buffer that can be
+   *    read without allocations. Every entry is protected by a sequence lock whose version is its position in
+   *    the stream so that readers can tell entries that were overwritten while they were copied.
+  */
+  class FeedbackRing: public ResponseListener {
+    public:
+      /**\fn FeedbackRing
+       * \brief
+       *    Class constructor allocating the ring buffers of all actuators
+       *
+       * \param[in] capacity
+       *    The number of entries kept per actuator
+      */
+      FeedbackRing(std::size_t const capacity);
+      FeedbackRing() = delete;
+      FeedbackRing(FeedbackRing const&) = delete;
+      FeedbackRing& operator = (FeedbackRing const&) = delete;
+      FeedbackRing(FeedbackRing&&) = delete;
+      FeedbackRing& operator = (FeedbackRing&&) = delete;
+
+      /**\fn onResponse
+       * \brief
+       *    Appends the feedback of a response to the ring of the actuator
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator that the response was received from [1, 32]
+       * \param[in] response
+       *    The response bytes, responses without a feedback are ignored
+       * \param[in] timestamp
+       *    The time the response was received
+      */
+      void onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                      std::chrono::steady_clock::time_point const& timestamp) noexcept override;
+
+      /**\fn getLatest
+       * \brief
+       *    Copies a consistent snapshot of the most recent entries of an actuator
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \param[out] samples
+       *    The buffer the entries are copied to, ordered from the oldest to the most recent one
+       * \param[in] num_samples
+       *    The maximum number of entries to be copied, the size of the buffer
+       * \return
+       *    The number of copied entries, fewer than requested if there are not enough entries yet or the oldest
+       *    ones were overwritten while being copied
+      */
+      [[nodiscard]]
+      std::size_t getLatest(std::uint32_t const actuator_id, StampedFeedback* samples,
+                            std::size_t const num_samples) const noexcept;
+
+      /**\fn getCount
+       * \brief
+       *    Get the number of entries that were written for an actuator since the start
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    The total number of entries including the ones that were already overwritten
+      */
+      [[nodiscard]]
+      std::uint64_t getCount(std::uint32_t const actuator_id) const noexcept;
+
+      /**\fn getCapacity
+       * \brief
+       *    Get the number of entries kept per actuator
+       *
+       * \return
+       *    The capacity of each ring
+      */
+      [[nodiscard]]
+      std::size_t getCapacity() const noexcept;
+
+    protected:
+      // Entries are packed instead of padded to cache lines so that a snapshot touches as few cache lines as possible
+      using Entry = SeqLock<StampedResponse,alignof(std::uint64_t)>;
+
+      /**\class Ring
+       * \brief
+       *    Ring of a single actuator, the head is the number of entries written so far and the i-th entry of the
+       *    stream is written with the version i+1
+      */
+      class alignas(64) Ring {
+        public:
+          std::atomic<std::uint64_t> head;
+          std::unique_ptr<Entry[]> entries;
+      };
+
+      std::size_t capacity_;
+      std::array<Ring,max_num_actuators> rings_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__TELEMETRY__FEEDBACK_RING
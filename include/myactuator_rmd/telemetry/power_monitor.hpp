@@ -0,0 +1,186 @@
+/**
+ * \file power_monitor.hpp
+ * \mainpage
+ *    Contains an accumulator for the estimated electrical power and energy of each actuator
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TELEMETRY__POWER_MONITOR
+#define MYACTUATOR_RMD__TELEMETRY__POWER_MONITOR
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "myactuator_rmd/driver/response_listener.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class PowerState
+   * \brief
+   *    Estimated electrical power and energy of an actuator
+  */
+  class PowerState {
+    public:
+      /**\fn PowerState
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] voltage_
+       *    The latest bus voltage in Volt, zero if it is not known yet
+       * \param[in] current_
+       *    The estimated current drawn from the bus in Ampere, zero if the bus voltage is not known yet
+       * \param[in] power_
+       *    The estimated electrical power in Watt
+       * \param[in] average_power_
+       *    The average estimated electrical power over the last completed window in Watt
+       * \param[in] energy_
+       *    The estimated electrical energy since the start in Joule
+      */
+      constexpr PowerState(float const voltage_ = 0.0f, float const current_ = 0.0f, float const power_ = 0.0f,
+                           float const average_power_ = 0.0f, double const energy_ = 0.0) noexcept;
+      PowerState(PowerState const&) = default;
+      PowerState& operator = (PowerState const&) = default;
+      PowerState(PowerState&&) = default;
+      PowerState& operator = (PowerState&&) = default;
+
+      float voltage;
+      float current;
+      float power;
+      float average_power;
+      double energy;
+  };
+
+  constexpr PowerState::PowerState(float const voltage_, float const current_, float const power_,
+                                   float const average_power_, double const energy_) noexcept
+  : voltage{voltage_}, current{current_}, power{power_}, average_power{average_power_}, energy{energy_} {
+    return;
+  }
+
+  /**\class PowerMonitor
+   * \brief
+   *    Listener estimating the electrical power and energy of each actuator from the torque current and shaft
+   *    speed contained in every feedback, so that the power draw can be monitored without any additional
+   *    requests. The power is estimated as the mechanical power k_t*|I*w| plus the copper losses I^2*R and held
+   *    constant in between samples. Braking energy is assumed to be dissipated rather than fed back to the bus
+   *    and all other losses are neglected. The bus voltage of occasional motor status 1 readings is only used for
+   *    converting the power to the current drawn from the bus.
+  */
+  class PowerMonitor: public ResponseListener {
+    public:
+      /**\fn PowerMonitor
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] torque_constant
+       *    The torque constant of the actuator at the output shaft in Nm/A, refer to actuator_constants.hpp
+       * \param[in] resistance
+       *    The resistance of the windings in Ohm that the copper losses are caused by
+       * \param[in] window
+       *    The duration of the window that the average power is computed over
+      */
+      PowerMonitor(float const torque_constant, float const resistance,
+                   std::chrono::steady_clock::duration const& window = std::chrono::seconds(1));
+      PowerMonitor() = delete;
+      PowerMonitor(PowerMonitor const&) = delete;
+      PowerMonitor& operator = (PowerMonitor const&) = delete;
+      PowerMonitor(PowerMonitor&&) = delete;
+      PowerMonitor& operator = (PowerMonitor&&) = delete;
+
+      /**\fn onResponse
+       * \brief
+       *    Integrates the energy up to the receive time of a feedback or motor status 1 and updates the current
+       *    and speed or the voltage respectively
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator that the response was received from [1, 32]
+       * \param[in] response
+       *    The response bytes, other responses are ignored
+       * \param[in] timestamp
+       *    The time the response was received
+      */
+      void onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                      std::chrono::steady_clock::time_point const& timestamp) noexcept override;
+
+      /**\fn getPowerState
+       * \brief
+       *    Get the estimated power and energy of an actuator
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    The power state or an empty optional if neither a feedback nor a motor status 1 was received for the
+       *    actuator yet
+      */
+      [[nodiscard]]
+      std::optional<PowerState> getPowerState(std::uint32_t const actuator_id) const noexcept;
+
+      /**\fn getTotalPowerState
+       * \brief
+       *    Get the estimated power and energy of all actuators on the bus
+       *
+       * \return
+       *    The summed current, power, average power and energy as well as the mean of the known voltages of all
+       *    actuators
+      */
+      [[nodiscard]]
+      PowerState getTotalPowerState() const noexcept;
+
+    protected:
+      /**\class Accumulator
+       * \brief
+       *    Accumulated energy of a single actuator at the time of the latest response together with the start
+       *    of the current window and the energy at that time
+      */
+      class Accumulator {
+        public:
+          float voltage;
+          float current;
+          float shaft_speed;
+          float average_power;
+          double energy;
+          double window_energy;
+          std::chrono::steady_clock::time_point timestamp;
+          std::chrono::steady_clock::time_point window_start;
+      };
+
+      /**\fn getPower
+       * \brief
+       *    Estimates the electrical power of an actuator
+       *
+       * \param[in] current
+       *    The torque current in Ampere
+       * \param[in] shaft_speed
+       *    The speed of the output shaft in degree per second
+       * \return
+       *    The estimated electrical power in Watt
+      */
+      [[nodiscard]]
+      float getPower(float const current, float const shaft_speed) const noexcept;
+
+      /**\fn toPowerState
+       * \brief
+       *    Converts an accumulator to the corresponding power state
+       *
+       * \param[in] accumulator
+       *    The accumulator of the actuator
+       * \return
+       *    The power state of the actuator
+      */
+      [[nodiscard]]
+      PowerState toPowerState(Accumulator const& accumulator) const noexcept;
+
+      float torque_constant_;
+      float resistance_;
+      std::chrono::steady_clock::duration window_;
+      std::array<SeqLock<Accumulator>,max_num_actuators> accumulators_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__TELEMETRY__POWER_MONITOR
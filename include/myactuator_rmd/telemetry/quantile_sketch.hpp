@@ -0,0 +1,114 @@
+/**
+ * \file quantile_sketch.hpp
+ * \mainpage
+ *    Contains a streaming sketch for estimating quantiles of durations
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TELEMETRY__QUANTILE_SKETCH
+#define MYACTUATOR_RMD__TELEMETRY__QUANTILE_SKETCH
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace myactuator_rmd {
+
+  /**\class QuantileSketch
+   * \brief
+   *    Streaming quantile sketch for durations with logarithmically spaced buckets: Any quantile is estimated
+   *    with a bounded relative error while each sample only costs a logarithm and an increment.
+   *    Old samples can be faded out by decaying the sketch periodically.
+  */
+  class QuantileSketch {
+    public:
+      /**\fn QuantileSketch
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] relative_accuracy
+       *    The relative error of the estimated quantiles ]0, 1[
+       * \param[in] min_value
+       *    The smallest duration that can be distinguished, smaller durations are clamped
+       * \param[in] max_value
+       *    The largest duration that can be distinguished, larger durations are clamped
+      */
+      QuantileSketch(double const relative_accuracy = 0.01,
+                     std::chrono::nanoseconds const& min_value = std::chrono::microseconds(1),
+                     std::chrono::nanoseconds const& max_value = std::chrono::seconds(10));
+      QuantileSketch(QuantileSketch const&) = default;
+      QuantileSketch& operator = (QuantileSketch const&) = default;
+      QuantileSketch(QuantileSketch&&) = default;
+      QuantileSketch& operator = (QuantileSketch&&) = default;
+
+      /**\fn add
+       * \brief
+       *    Adds a single sample to the sketch
+       *
+       * \param[in] value
+       *    The measured duration
+      */
+      void add(std::chrono::nanoseconds const& value) noexcept;
+
+      /**\fn getQuantile
+       * \brief
+       *    Estimates the given quantile of all samples added so far
+       *
+       * \param[in] quantile
+       *    The quantile that should be estimated [0, 1], e.g. 0.999 for the 99.9th percentile
+       * \return
+       *    The estimated duration, zero if the sketch is empty
+      */
+      [[nodiscard]]
+      std::chrono::nanoseconds getQuantile(double const quantile) const noexcept;
+
+      /**\fn getCount
+       * \brief
+       *    Get the (decayed) number of samples in the sketch
+       *
+       * \return
+       *    The number of samples rounded to the closest integer
+      */
+      [[nodiscard]]
+      std::uint64_t getCount() const noexcept;
+
+      /**\fn decay
+       * \brief
+       *    Halves the weight of all samples so that recent samples dominate the estimate while the shape of the
+       *    distribution including its sparse tail is preserved
+      */
+      void decay() noexcept;
+
+      /**\fn clear
+       * \brief
+       *    Removes all samples from the sketch
+      */
+      void clear() noexcept;
+
+    protected:
+      /**\fn getIndex
+       * \brief
+       *    Get the index of the bucket a duration falls into
+       *
+       * \param[in] value
+       *    The duration in nanoseconds
+       * \return
+       *    The index of the corresponding bucket
+      */
+      [[nodiscard]]
+      std::size_t getIndex(double const value) const noexcept;
+
+      double gamma_;
+      double log_gamma_;
+      double min_value_;
+      std::vector<double> buckets_;
+      double count_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__TELEMETRY__QUANTILE_SKETCH
@@ -0,0 +1,54 @@
+/**
+ * \file stamped_response.hpp
+ * \mainpage
+ *    Contains a raw response of an actuator together with the time it was received
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TELEMETRY__STAMPED_RESPONSE
+#define MYACTUATOR_RMD__TELEMETRY__STAMPED_RESPONSE
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+
+namespace myactuator_rmd {
+
+  /**\class StampedResponse
+   * \brief
+   *    Raw response of an actuator together with the time it was received
+  */
+  class StampedResponse {
+    public:
+      /**\fn StampedResponse
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] data_
+       *    The response bytes
+       * \param[in] timestamp_
+       *    The time the response was received
+      */
+      constexpr StampedResponse(std::array<std::uint8_t,8> const& data_ = {},
+                                std::chrono::steady_clock::time_point const& timestamp_ = {}) noexcept;
+      StampedResponse(StampedResponse const&) = default;
+      StampedResponse& operator = (StampedResponse const&) = default;
+      StampedResponse(StampedResponse&&) = default;
+      StampedResponse& operator = (StampedResponse&&) = default;
+
+      std::array<std::uint8_t,8> data;
+      std::chrono::steady_clock::time_point timestamp;
+  };
+
+  constexpr StampedResponse::StampedResponse(std::array<std::uint8_t,8> const& data_,
+                                             std::chrono::steady_clock::time_point const& timestamp_) noexcept
+  : data{data_}, timestamp{timestamp_} {
+    return;
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__TELEMETRY__STAMPED_RESPONSE
@@ -0,0 +1,179 @@
+/**
+ * \file state_cache.hpp
+ * \mainpage
+ *    Contains a lock-free cache for the latest state of each actuator
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TELEMETRY__STATE_CACHE
+#define MYACTUATOR_RMD__TELEMETRY__STATE_CACHE
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/driver/response_listener.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/telemetry/stamped_response.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class StateCache
+   * \brief
+   *    Listener caching the latest state of each actuator, each kind of state of each actuator is protected by
+   *    its own sequence lock. The feedback of all closed-loop control commands and motor status 2 share a single
+   *    slot.
+  */
+  class StateCache: public ResponseListener {
+    public:
+      StateCache() = default;
+      StateCache(StateCache const&) = delete;
+      StateCache& operator = (StateCache const&) = delete;
+      StateCache(StateCache&&) = delete;
+      StateCache& operator = (StateCache&&) = delete;
+
+      /**\fn onResponse
+       * \brief
+       *    Stores a response
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator that the response was received from [1, 32]
+       * \param[in] response
+       *    The response bytes, responses to commands that are not cached are ignored
+       * \param[in] timestamp
+       *    The time the response was received
+      */
+      void onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                      std::chrono::steady_clock::time_point const& timestamp) noexcept override;
+
+      /**\fn getResponse
+       * \brief
+       *    Get the latest response of an actuator to a given command
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \param[in] command
+       *    The command of interest, any closed-loop control command or motor status 2 returns the latest feedback
+       * \return
+       *    The latest response together with its timestamp if there is any
+      */
+      [[nodiscard]]
+      std::optional<StampedResponse> getResponse(std::uint32_t const actuator_id, CommandType const command) const noexcept;
+
+      /**\fn getFeedback
+       * \brief
+       *    Get the latest feedback of an actuator, from motor status 2 or any closed-loop control command
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    The feedback containing current, speed and position if it was received before
+      */
+      [[nodiscard]]
+      std::optional<Feedback> getFeedback(std::uint32_t const actuator_id) const noexcept;
+
+      /**\fn getMotorStatus1
+       * \brief
+       *    Get the latest motor status 1 of an actuator
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    The motor status 1 containing temperature, voltage and error codes if it was received before
+      */
+      [[nodiscard]]
+      std::optional<MotorStatus1> getMotorStatus1(std::uint32_t const actuator_id) const noexcept;
+
+      /**\fn getMotorStatus3
+       * \brief
+       *    Get the latest motor status 3 of an actuator
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    The motor status 3 containing detailed current information if it was received before
+      */
+      [[nodiscard]]
+      std::optional<MotorStatus3> getMotorStatus3(std::uint32_t const actuator_id) const noexcept;
+
+      /**\fn getMultiTurnAngle
+       * \brief
+       *    Get the latest multi-turn angle of an actuator
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    The multi-turn angle in degree if it was received before
+      */
+      [[nodiscard]]
+      std::optional<float> getMultiTurnAngle(std::uint32_t const actuator_id) const noexcept;
+
+      /**\fn getSingleTurnAngle
+       * \brief
+       *    Get the latest single-turn angle of an actuator
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \return
+       *    The single-turn angle in degree if it was received before
+      */
+      [[nodiscard]]
+      std::optional<float> getSingleTurnAngle(std::uint32_t const actuator_id) const noexcept;
+
+    protected:
+      /**\enum SlotKind
+       * \brief
+       *    The kinds of state that are cached for each actuator
+      */
+      enum class SlotKind: std::uint8_t {
+        FEEDBACK = 0,
+        MOTOR_STATUS_1 = 1,
+        MOTOR_STATUS_3 = 2,
+        MULTI_TURN_ANGLE = 3,
+        SINGLE_TURN_ANGLE = 4
+      };
+
+      // Number of different kinds of state
+      static constexpr std::size_t num_slot_kinds {5};
+
+      /**\fn getSlotKind
+       * \brief
+       *    Get the slot that the response to a command is cached in
+       *
+       * \param[in] command
+       *    The command byte of the response
+       * \return
+       *    The kind of the slot or an empty optional if the command is not cached
+      */
+      [[nodiscard]]
+      static std::optional<SlotKind> getSlotKind(std::uint8_t const command) noexcept;
+
+      /**\fn read
+       * \brief
+       *    Reads a consistent copy of a slot
+       *
+       * \param[in] actuator_id
+       *    The id of the actuator
+       * \param[in] kind
+       *    The kind of state
+       * \return
+       *    The response and its timestamp if the slot was written before
+      */
+      [[nodiscard]]
+      std::optional<StampedResponse> read(std::uint32_t const actuator_id, SlotKind const kind) const noexcept;
+
+      std::array<std::array<SeqLock<StampedResponse>,num_slot_kinds>,max_num_actuators> slots_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__TELEMETRY__STATE_CACHE
@@ -0,0 +1,217 @@
+/**
+ * \file state_history.hpp
+ * \mainpage
+ *    Contains a compact history of raw responses that are only decoded on access
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TELEMETRY__STATE_HISTORY
+#define MYACTUATOR_RMD__TELEMETRY__STATE_HISTORY
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/protocol/single_motor_message.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class HistoryRecord
+   * \brief
+   *    Raw response stored in the history together with its receive time relative to the start of its segment
+  */
+  class HistoryRecord {
+    public:
+      /**\fn HistoryRecord
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] data_
+       *    The response bytes
+       * \param[in] offset_
+       *    The receive time in microseconds relative to the start of the segment of the history
+      */
+      constexpr HistoryRecord(std::array<std::uint8_t,8> const& data_ = {}, std::uint32_t const offset_ = 0) noexcept;
+      HistoryRecord(HistoryRecord const&) = default;
+      HistoryRecord& operator = (HistoryRecord const&) = default;
+      HistoryRecord(HistoryRecord&&) = default;
+      HistoryRecord& operator = (HistoryRecord&&) = default;
+
+      std::array<std::uint8_t,8> data;
+      std::uint32_t offset;
+  };
+
+  constexpr HistoryRecord::HistoryRecord(std::array<std::uint8_t,8> const& data_, std::uint32_t const offset_) noexcept
+  : data{data_}, offset{offset_} {
+    return;
+  }
+
+  /**\class StateHistory
+   * \brief
+   *    History of the responses of an actuator that only keeps the raw bytes and a 32-bit receive time offset
+   *    per response. The contents are decoded on access with the decoders of the responses. The receive times
+   *    are stored with a resolution of a microsecond relative to the start of a segment, a new segment is
+   *    started whenever the offset would overflow after about 71 minutes.
+  */
+  class StateHistory {
+    public:
+      StateHistory() = default;
+      StateHistory(StateHistory const&) = default;
+      StateHistory& operator = (StateHistory const&) = default;
+      StateHistory(StateHistory&&) = default;
+      StateHistory& operator = (StateHistory&&) = default;
+
+      /**\fn push
+       * \brief
+       *    Appends a response to the history
+       *
+       * \param[in] response
+       *    The response bytes
+       * \param[in] timestamp
+       *    The time the response was received, should not be earlier than the previous one
+      */
+      void push(std::array<std::uint8_t,8> const& response,
+                std::chrono::steady_clock::time_point const& timestamp = std::chrono::steady_clock::now());
+
+      /**\fn reserve
+       * \brief
+       *    Allocates memory for the given number of responses upfront
+       *
+       * \param[in] num_responses
+       *    The number of responses to allocate memory for
+      */
+      void reserve(std::size_t const num_responses);
+
+      /**\fn clear
+       * \brief
+       *    Removes all responses from the history
+      */
+      void clear() noexcept;
+
+      /**\fn size
+       * \brief
+       *    Get the number of responses in the history
+       *
+       * \return
+       *    The number of responses
+      */
+      [[nodiscard]]
+      std::size_t size() const noexcept;
+
+      /**\fn getData
+       * \brief
+       *    Get the bytes of a response
+       *
+       * \param[in] index
+       *    The index of the response in the order it was pushed
+       * \return
+       *    The response bytes
+      */
+      [[nodiscard]]
+      std::array<std::uint8_t,8> const& getData(std::size_t const index) const noexcept;
+
+      /**\fn getTimestamp
+       * \brief
+       *    Get the time a response was received
+       *
+       * \param[in] index
+       *    The index of the response in the order it was pushed
+       * \return
+       *    The receive time truncated to microseconds
+      */
+      [[nodiscard]]
+      std::chrono::steady_clock::time_point getTimestamp(std::size_t const index) const noexcept;
+
+      /**\fn getResponse
+       * \brief
+       *    Decodes a response of the history
+       *
+       * \tparam R
+       *    The type of the response, e.g. GetMotorStatus1Response
+       * \param[in] index
+       *    The index of the response in the order it was pushed
+       * \return
+       *    The decoded response or an empty optional if it belongs to another command
+      */
+      template <typename R>
+      [[nodiscard]]
+      std::optional<R> getResponse(std::size_t const index) const noexcept;
+
+      /**\fn getFeedback
+       * \brief
+       *    Decodes the feedback of a response, e.g. GetMotorStatus2Response or SetTorqueResponse
+       *
+       * \param[in] index
+       *    The index of the response in the order it was pushed
+       * \return
+       *    The feedback or an empty optional if the response does not contain any
+      */
+      [[nodiscard]]
+      std::optional<Feedback> getFeedback(std::size_t const index) const noexcept;
+
+      /**\fn getMotorStatus1
+       * \brief
+       *    Decodes the motor status 1 of a response
+       *
+       * \param[in] index
+       *    The index of the response in the order it was pushed
+       * \return
+       *    The motor status 1 or an empty optional if the response belongs to another command
+      */
+      [[nodiscard]]
+      std::optional<MotorStatus1> getMotorStatus1(std::size_t const index) const noexcept;
+
+      /**\fn getMotorStatus3
+       * \brief
+       *    Decodes the motor status 3 of a response
+       *
+       * \param[in] index
+       *    The index of the response in the order it was pushed
+       * \return
+       *    The motor status 3 or an empty optional if the response belongs to another command
+      */
+      [[nodiscard]]
+      std::optional<MotorStatus3> getMotorStatus3(std::size_t const index) const noexcept;
+
+      /**\fn getRecords
+       * \brief
+       *    Get the raw records, e.g. for copying or writing them to disk in bulk
+       *
+       * \return
+       *    The records in the order they were pushed
+      */
+      [[nodiscard]]
+      std::vector<HistoryRecord> const& getRecords() const noexcept;
+
+    protected:
+      /**\class Segment
+       * \brief
+       *    Consecutive records sharing the same start time
+      */
+      class Segment {
+        public:
+          std::size_t first;
+          std::chrono::steady_clock::time_point start;
+      };
+
+      std::vector<HistoryRecord> records_;
+      std::vector<Segment> segments_;
+  };
+
+  template <typename R>
+  std::optional<R> StateHistory::getResponse(std::size_t const index) const noexcept {
+    return tryDecode<R>(records_[index].data);
+  }
+
+}
+
+#endif // MYACTUATOR_RMD__TELEMETRY__STATE_HISTORY
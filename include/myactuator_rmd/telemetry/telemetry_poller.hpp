@@ -0,0 +1,190 @@
+/**
+ * \file telemetry_poller.hpp
+ * \mainpage
+ *    Contains a scheduler that polls the state of actuators in the background
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TELEMETRY__TELEMETRY_POLLER
+#define MYACTUATOR_RMD__TELEMETRY__TELEMETRY_POLLER
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+
+
+namespace myactuator_rmd {
+
+  /**\class TelemetryRequest
+   * \brief
+   *    A read request that should be issued periodically to a given actuator
+  */
+  class TelemetryRequest {
+    public:
+      /**\fn TelemetryRequest
+       * \brief
+       *    Class constructor
+       *
+       * \param[in] actuator_id_
+       *    The id of the actuator that should be polled
+       * \param[in] command_
+       *    The read command that should be sent, e.g. CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG
+       * \param[in] rate_
+       *    The desired rate in Hz
+      */
+      constexpr TelemetryRequest(std::uint32_t const actuator_id_, CommandType const command_, float const rate_) noexcept;
+      TelemetryRequest() = delete;
+      TelemetryRequest(TelemetryRequest const&) = default;
+      TelemetryRequest& operator = (TelemetryRequest const&) = default;
+      TelemetryRequest(TelemetryRequest&&) = default;
+      TelemetryRequest& operator = (TelemetryRequest&&) = default;
+
+      std::uint32_t actuator_id;
+      CommandType command;
+      float rate;
+  };
+
+  constexpr TelemetryRequest::TelemetryRequest(std::uint32_t const actuator_id_, CommandType const command_, float const rate_) noexcept
+  : actuator_id{actuator_id_}, command{command_}, rate{rate_} {
+    return;
+  }
+
+  /**\class TelemetryPoller
+   * \brief
+   *    Polls the state of actuators at the desired rates from a background thread. The reads are sent as state
+   *    reads over a ThreadSafeDriver and therefore only use bus time left over by the set-points. Their responses
+   *    are published to the listeners registered with the driver, e.g. a StateCache. The bus time spent on
+   *    polling is limited by a token bucket so that the bus utilisation caused by the poller stays below a
+   *    configured ceiling.
+  */
+  class TelemetryPoller {
+    public:
+      /**\fn TelemetryPoller
+       * \brief
+       *    Class constructor, starts the polling thread
+       *
+       * \param[in] driver
+       *    The driver used for communicating with the actuators, publishes the responses to its listeners
+       * \param[in] requests
+       *    The read requests that should be issued periodically
+       * \param[in] baud_rate
+       *    The Baud rate of the bus used for estimating the bus time of each read
+       * \param[in] max_utilisation
+       *    The maximum share of the bus time that the poller might use ]0, 1]
+      */
+      TelemetryPoller(ThreadSafeDriver& driver, std::vector<TelemetryRequest> const& requests,
+                      CanBaudRate const baud_rate = CanBaudRate::MBPS1, float const max_utilisation = 0.2f);
+      TelemetryPoller() = delete;
+      TelemetryPoller(TelemetryPoller const&) = delete;
+      TelemetryPoller& operator = (TelemetryPoller const&) = delete;
+      TelemetryPoller(TelemetryPoller&&) = delete;
+      TelemetryPoller& operator = (TelemetryPoller&&) = delete;
+      ~TelemetryPoller();
+
+      /**\fn getRequiredUtilisation
+       * \brief
+       *    Get the bus utilisation the requests would need in order to be polled at their desired rates
+       *
+       * \return
+       *    The required share of the bus time, rates are throttled if this exceeds the maximum utilisation
+      */
+      [[nodiscard]]
+      float getRequiredUtilisation() const noexcept;
+
+      /**\fn getNumPolls
+       * \brief
+       *    Get the number of successful reads
+       *
+       * \return
+       *    The number of reads that were answered by the actuators
+      */
+      [[nodiscard]]
+      std::uint64_t getNumPolls() const noexcept;
+
+      /**\fn getNumErrors
+       * \brief
+       *    Get the number of reads that failed, e.g. due to a timeout
+       *
+       * \return
+       *    The number of failed reads
+      */
+      [[nodiscard]]
+      std::uint64_t getNumErrors() const noexcept;
+
+      /**\fn getNumThrottled
+       * \brief
+       *    Get the number of reads that had to be delayed in order to stay below the utilisation ceiling
+       *
+       * \return
+       *    The number of delayed reads
+      */
+      [[nodiscard]]
+      std::uint64_t getNumThrottled() const noexcept;
+
+    protected:
+      using Clock = std::chrono::steady_clock;
+
+      /**\class ScheduledRequest
+       * \brief
+       *    A telemetry request together with the time it is due next
+      */
+      class ScheduledRequest {
+        public:
+          TelemetryRequest request;
+          std::chrono::nanoseconds period;
+          Clock::time_point next_due;
+      };
+
+      /**\fn poll
+       * \brief
+       *    Sends a single read request
+       *
+       * \param[in] request
+       *    The request to be sent
+      */
+      void poll(TelemetryRequest const& request) noexcept;
+
+      /**\fn refill
+       * \brief
+       *    Adds the bus time that has become available since the last refill to the budget
+       *
+       * \param[in] now
+       *    The current time
+      */
+      void refill(Clock::time_point const& now) noexcept;
+
+      /**\fn run
+       * \brief
+       *    Main loop of the polling thread
+      */
+      void run() noexcept;
+
+      ThreadSafeDriver& driver_;
+      std::vector<ScheduledRequest> schedule_;
+      float max_utilisation_;
+      std::chrono::nanoseconds cost_;
+      std::chrono::nanoseconds budget_;
+      std::chrono::nanoseconds max_budget_;
+      Clock::time_point last_refill_;
+      std::atomic<std::uint64_t> num_polls_;
+      std::atomic<std::uint64_t> num_errors_;
+      std::atomic<std::uint64_t> num_throttled_;
+      std::mutex mutex_;
+      std::condition_variable condition_variable_;
+      bool is_running_;
+      std::thread thread_;
+  };
+
+}
+
+#endif // MYACTUATOR_RMD__TELEMETRY__TELEMETRY_POLLER
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
@@ -22,6 +23,7 @@
 #include <sys/socket.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include "myactuator_rmd/can/exceptions.hpp"
@@ -140,6 +142,25 @@ namespace myactuator_rmd {
       return f;
     }
 
+    std::size_t Node::readBatch(struct ::can_frame* frames, std::size_t const num_frames) const {
+      // Bounded so that the message headers fit on the stack
+      constexpr std::size_t max_num_frames {64};
+      auto const num_requested {std::min(num_frames, max_num_frames)};
+      std::array<struct ::iovec,max_num_frames> iovecs {};
+      std::array<struct ::mmsghdr,max_num_frames> msgs {};
+      for (std::size_t i = 0; i < num_requested; ++i) {
+        iovecs[i].iov_base = &frames[i];
+        iovecs[i].iov_len = sizeof(struct ::can_frame);
+        msgs[i].msg_hdr.msg_iov = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+      }
+      int const num_received {::recvmmsg(socket_, msgs.data(), static_cast<unsigned int>(num_requested), MSG_WAITFORONE, nullptr)};
+      if (num_received < 0) {
+        throw SocketException(errno, std::generic_category(), "Interface '" + ifname_ + "' - Could not read CAN frames");
+      }
+      return static_cast<std::size_t>(num_received);
+    }
+
     void Node::write(Frame const& frame) {
       return write(frame.getId(), frame.getData());
     }
@@ -157,6 +178,21 @@ namespace myactuator_rmd {
       return;
     }
 
+    std::size_t Node::discardPending() noexcept {
+      std::size_t num_discarded {0};
+      struct ::can_frame frame {};
+      while (::recv(socket_, &frame, sizeof(struct ::can_frame), MSG_DONTWAIT) > 0) {
+        ++num_discarded;
+      }
+      return num_discarded;
+    }
+
+    int Node::release() noexcept {
+      int const socket {socket_};
+      socket_ = -1;
+      return socket;
+    }
+
     void Node::initSocket(std::string const& ifname) {
       ifname_ = ifname;
       socket_ = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
@@ -180,7 +216,9 @@ namespace myactuator_rmd {
     }
 
     void Node::closeSocket() noexcept {
-      ::close(socket_);
+      if (socket_ >= 0) {
+        ::close(socket_);
+      }
       return;
     }
 
@@ -0,0 +1,243 @@
+#include "myactuator_rmd/coroutine/async_actuator_interface.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/actuator_state/control_mode.hpp"
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/gains.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_2.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/coroutine/bus_awaiter.hpp"
+#include "myactuator_rmd/coroutine/scheduler.hpp"
+#include "myactuator_rmd/coroutine/task.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  AsyncActuatorInterface::AsyncActuatorInterface(ThreadSafeDriver& driver, Scheduler& scheduler, std::uint32_t const actuator_id)
+  : driver_{driver}, scheduler_{scheduler}, actuator_id_{actuator_id} {
+    driver.addId(actuator_id); // Make the actuator listen to the responses
+    return;
+  }
+
+  Task<std::int32_t> AsyncActuatorInterface::getAccelerationAsync() {
+    GetAccelerationRequest const request {};
+    GetAccelerationResponse const response {co_await sendRecv(request)};
+    co_return response.getAcceleration();
+  }
+
+  Task<std::uint16_t> AsyncActuatorInterface::getCanIdAsync() {
+    GetCanIdRequest const request {};
+    GetCanIdResponse const response {co_await sendRecv(request)};
+    co_return response.getCanId();
+  }
+
+  Task<Gains> AsyncActuatorInterface::getControllerGainsAsync() {
+    GetControllerGainsRequest const request {};
+    GetControllerGainsResponse const response {co_await sendRecv(request)};
+    co_return response.getGains();
+  }
+
+  Task<ControlMode> AsyncActuatorInterface::getControlModeAsync() {
+    GetControlModeRequest const request {};
+    GetControlModeResponse const response {co_await sendRecv(request)};
+    co_return response.getMode();
+  }
+
+  Task<std::string> AsyncActuatorInterface::getMotorModelAsync() {
+    GetMotorModelRequest const request {};
+    GetMotorModelResponse const response {co_await sendRecv(request)};
+    co_return response.getModel();
+  }
+
+  Task<float> AsyncActuatorInterface::getMotorPowerAsync() {
+    GetMotorPowerRequest const request {};
+    GetMotorPowerResponse const response {co_await sendRecv(request)};
+    co_return response.getPower();
+  }
+
+  Task<MotorStatus1> AsyncActuatorInterface::getMotorStatus1Async() {
+    GetMotorStatus1Request const request {};
+    GetMotorStatus1Response const response {co_await sendRecv(request)};
+    co_return response.getStatus();
+  }
+
+  Task<MotorStatus2> AsyncActuatorInterface::getMotorStatus2Async() {
+    GetMotorStatus2Request const request {};
+    GetMotorStatus2Response const response {co_await sendRecv(request)};
+    co_return response.getStatus();
+  }
+
+  Task<MotorStatus3> AsyncActuatorInterface::getMotorStatus3Async() {
+    GetMotorStatus3Request const request {};
+    GetMotorStatus3Response const response {co_await sendRecv(request)};
+    co_return response.getStatus();
+  }
+
+  Task<float> AsyncActuatorInterface::getMultiTurnAngleAsync() {
+    GetMultiTurnAngleRequest const request {};
+    GetMultiTurnAngleResponse const response {co_await sendRecv(request)};
+    co_return response.getAngle();
+  }
+
+  Task<std::int32_t> AsyncActuatorInterface::getMultiTurnEncoderPositionAsync() {
+    GetMultiTurnEncoderPositionRequest const request {};
+    GetMultiTurnEncoderPositionResponse const response {co_await sendRecv(request)};
+    co_return response.getPosition();
+  }
+
+  Task<std::int32_t> AsyncActuatorInterface::getMultiTurnEncoderOriginalPositionAsync() {
+    GetMultiTurnEncoderOriginalPositionRequest const request {};
+    GetMultiTurnEncoderOriginalPositionResponse const response {co_await sendRecv(request)};
+    co_return response.getPosition();
+  }
+
+  Task<std::int32_t> AsyncActuatorInterface::getMultiTurnEncoderZeroOffsetAsync() {
+    GetMultiTurnEncoderZeroOffsetRequest const request {};
+    GetMultiTurnEncoderZeroOffsetResponse const response {co_await sendRecv(request)};
+    co_return response.getPosition();
+  }
+
+  Task<std::chrono::milliseconds> AsyncActuatorInterface::getRuntimeAsync() {
+    GetSystemRuntimeRequest const request {};
+    GetSystemRuntimeResponse const response {co_await sendRecv(request)};
+    co_return response.getRuntime();
+  }
+
+  Task<float> AsyncActuatorInterface::getSingleTurnAngleAsync() {
+    GetSingleTurnAngleRequest const request {};
+    GetSingleTurnAngleResponse const response {co_await sendRecv(request)};
+    co_return response.getAngle();
+  }
+
+  Task<std::int16_t> AsyncActuatorInterface::getSingleTurnEncoderPositionAsync() {
+    GetSingleTurnEncoderPositionRequest const request {};
+    GetSingleTurnEncoderPositionResponse const response {co_await sendRecv(request)};
+    co_return response.getPosition();
+  }
+
+  Task<std::uint32_t> AsyncActuatorInterface::getVersionDateAsync() {
+    GetVersionDateRequest const request {};
+    GetVersionDateResponse const response {co_await sendRecv(request)};
+    co_return response.getVersion();
+  }
+
+  Task<void> AsyncActuatorInterface::lockBrakeAsync() {
+    LockBrakeRequest const request {};
+    [[maybe_unused]] LockBrakeResponse const response {co_await sendRecv(request)};
+    co_return;
+  }
+
+  Task<void> AsyncActuatorInterface::releaseBrakeAsync() {
+    ReleaseBrakeRequest const request {};
+    [[maybe_unused]] ReleaseBrakeResponse const response {co_await sendRecv(request)};
+    co_return;
+  }
+
+  Task<void> AsyncActuatorInterface::resetAsync() {
+    ResetRequest const request {};
+    co_await send(request);
+    co_return;
+  }
+
+  Task<Feedback> AsyncActuatorInterface::sendCurrentSetpointAsync(float const current) {
+    SetTorqueRequest const request {current};
+    SetTorqueResponse const response {co_await sendRecv(request)};
+    co_return response.getStatus();
+  }
+
+  Task<Feedback> AsyncActuatorInterface::sendPositionAbsoluteSetpointAsync(float const position, float const max_speed) {
+    SetPositionAbsoluteRequest const request {position, max_speed};
+    SetPositionAbsoluteResponse const response {co_await sendRecv(request)};
+    co_return response.getStatus();
+  }
+
+  Task<Feedback> AsyncActuatorInterface::sendTorqueSetpointAsync(float const torque, float const torque_constant) {
+    auto const current {torque/torque_constant};
+    co_return co_await sendCurrentSetpointAsync(current);
+  }
+
+  Task<Feedback> AsyncActuatorInterface::sendVelocitySetpointAsync(float const speed) {
+    SetVelocityRequest const request {speed};
+    SetVelocityResponse const response {co_await sendRecv(request)};
+    co_return response.getStatus();
+  }
+
+  Task<void> AsyncActuatorInterface::setAccelerationAsync(std::uint32_t const acceleration, AccelerationType const mode) {
+    SetAccelerationRequest const request {acceleration, mode};
+    [[maybe_unused]] SetAccelerationResponse const response {co_await sendRecv(request)};
+    co_return;
+  }
+
+  Task<void> AsyncActuatorInterface::setCanIdAsync(std::uint16_t const can_id) {
+    SetCanIdRequest const request {can_id};
+    [[maybe_unused]] SetCanIdResponse const response {co_await sendRecv(request)};
+    co_return;
+  }
+
+  Task<std::int32_t> AsyncActuatorInterface::setCurrentPositionAsEncoderZeroAsync() {
+    SetCurrentPositionAsEncoderZeroRequest const request {};
+    SetCurrentPositionAsEncoderZeroResponse const response {co_await sendRecv(request)};
+    co_return response.getEncoderZero();
+  }
+
+  Task<void> AsyncActuatorInterface::setEncoderZeroAsync(std::int32_t const encoder_offset) {
+    SetEncoderZeroRequest const request {encoder_offset};
+    [[maybe_unused]] SetEncoderZeroResponse const response {co_await sendRecv(request)};
+    co_return;
+  }
+
+  Task<void> AsyncActuatorInterface::setCanBaudRateAsync(CanBaudRate const baud_rate) {
+    SetCanBaudRateRequest const request {baud_rate};
+    co_await send(request);
+    co_return;
+  }
+
+  Task<Gains> AsyncActuatorInterface::setControllerGainsAsync(Gains const gains, bool const is_persistent) {
+    if (is_persistent) {
+      SetControllerGainsPersistentlyRequest const request {gains};
+      SetControllerGainsPersistentlyResponse const response {co_await sendRecv(request)};
+      co_return response.getGains();
+    } else {
+      SetControllerGainsRequest const request {gains};
+      SetControllerGainsResponse const response {co_await sendRecv(request)};
+      co_return response.getGains();
+    }
+  }
+
+  Task<void> AsyncActuatorInterface::setTimeoutAsync(std::chrono::milliseconds const timeout) {
+    SetTimeoutRequest const request {timeout};
+    [[maybe_unused]] SetTimeoutResponse const response {co_await sendRecv(request)};
+    co_return;
+  }
+
+  Task<void> AsyncActuatorInterface::shutdownMotorAsync() {
+    ShutdownMotorRequest const request {};
+    [[maybe_unused]] ShutdownMotorResponse const response {co_await sendRecv(request)};
+    co_return;
+  }
+
+  Task<void> AsyncActuatorInterface::stopMotorAsync() {
+    StopMotorRequest const request {};
+    [[maybe_unused]] StopMotorResponse const response {co_await sendRecv(request)};
+    co_return;
+  }
+
+  BusAwaiter AsyncActuatorInterface::send(Message const& msg) {
+    return BusAwaiter{driver_, scheduler_, ThreadSafeDriver::RequestType::SEND, actuator_id_, msg};
+  }
+
+  BusAwaiter AsyncActuatorInterface::sendRecv(Message const& request) {
+    return BusAwaiter{driver_, scheduler_, ThreadSafeDriver::RequestType::SEND_RECV, actuator_id_, request};
+  }
+
+}
@@ -0,0 +1,98 @@
+#include "myactuator_rmd/coroutine/scheduler.hpp"
+
+#include <cerrno>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <utility>
+
+#include <semaphore.h>
+
+#include "myactuator_rmd/coroutine/task.hpp"
+
+
+namespace myactuator_rmd {
+
+  Scheduler::Scheduler()
+  : mutex_{}, num_events_{}, ready_{}, num_active_{0}, exception_{} {
+    if (::sem_init(&num_events_, 0, 0) < 0) {
+      throw std::system_error(errno, std::generic_category(), "Could not initialise scheduler semaphore");
+    }
+    return;
+  }
+
+  Scheduler::~Scheduler() {
+    ::sem_destroy(&num_events_);
+    return;
+  }
+
+  void Scheduler::spawn(Task<void> task) {
+    {
+      std::lock_guard<std::mutex> const lock {mutex_};
+      ++num_active_;
+    }
+    static_cast<void>(start(std::move(task)));
+    return;
+  }
+
+  void Scheduler::post(std::coroutine_handle<> const handle) {
+    {
+      std::lock_guard<std::mutex> const lock {mutex_};
+      ready_.push_back(handle);
+    }
+    ::sem_post(&num_events_);
+    return;
+  }
+
+  void Scheduler::run() {
+    while (true) {
+      std::coroutine_handle<> handle {};
+      {
+        std::lock_guard<std::mutex> const lock {mutex_};
+        if (ready_.empty() && (num_active_ == 0)) {
+          break;
+        }
+      }
+      while (::sem_wait(&num_events_) < 0) {
+        // Only interrupted by a signal, retry
+      }
+      {
+        std::lock_guard<std::mutex> const lock {mutex_};
+        if (ready_.empty()) {
+          // A task has finished
+          continue;
+        }
+        handle = ready_.front();
+        ready_.pop_front();
+      }
+      handle.resume();
+    }
+    if (exception_) {
+      std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+    return;
+  }
+
+  Scheduler::DetachedTask Scheduler::start(Task<void> task) {
+    co_await ScheduleAwaiter{*this};
+    std::exception_ptr exception {};
+    try {
+      co_await task;
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    finish(exception);
+  }
+
+  void Scheduler::finish(std::exception_ptr const& exception) noexcept {
+    std::lock_guard<std::mutex> const lock {mutex_};
+    if (exception && !exception_) {
+      exception_ = exception;
+    }
+    --num_active_;
+    ::sem_post(&num_events_);
+    return;
+  }
+
+}
@@ -0,0 +1,91 @@
+#include "myactuator_rmd/driver/adaptive_timeout.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "myactuator_rmd/telemetry/quantile_sketch.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  AdaptiveTimeout::AdaptiveTimeout(double const factor, std::chrono::microseconds const& floor,
+                                   std::chrono::microseconds const& ceiling, double const quantile,
+                                   std::uint64_t const min_samples, std::uint64_t const window)
+  : factor_{factor}, floor_{floor}, ceiling_{ceiling}, quantile_{quantile}, min_samples_{min_samples},
+    window_{window}, entries_{} {
+    if (factor < 1.0) {
+      throw ValueRangeException("Timeout factor '" + std::to_string(factor) + "' has to be at least one");
+    }
+    if ((floor.count() <= 0) || (ceiling < floor)) {
+      throw ValueRangeException("Timeout floor has to be positive and below the ceiling");
+    }
+    if ((quantile <= 0.0) || (quantile > 1.0)) {
+      throw ValueRangeException("Quantile '" + std::to_string(quantile) + "' out of range ]0, 1]");
+    }
+    if (window < min_samples) {
+      throw ValueRangeException("Window has to contain at least the minimum number of samples");
+    }
+    return;
+  }
+
+  std::chrono::microseconds AdaptiveTimeout::getTimeout(std::uint32_t const actuator_id, std::uint8_t const command) const noexcept {
+    auto const it {entries_.find({actuator_id, command})};
+    if (it == entries_.end()) {
+      return ceiling_;
+    }
+    return it->second.timeout;
+  }
+
+  std::optional<std::chrono::nanoseconds> AdaptiveTimeout::getRoundTripTime(std::uint32_t const actuator_id,
+                                                                           std::uint8_t const command) const noexcept {
+    auto const it {entries_.find({actuator_id, command})};
+    if ((it == entries_.end()) || (it->second.sketch.getCount() == 0)) {
+      return std::nullopt;
+    }
+    return it->second.sketch.getQuantile(quantile_);
+  }
+
+  void AdaptiveTimeout::addRoundTrip(std::uint32_t const actuator_id, std::uint8_t const command,
+                                     std::chrono::nanoseconds const& round_trip_time) {
+    update(getEntry(actuator_id, command), round_trip_time, false);
+    return;
+  }
+
+  void AdaptiveTimeout::addTimeout(std::uint32_t const actuator_id, std::uint8_t const command) {
+    auto& entry {getEntry(actuator_id, command)};
+    // The actual round-trip time is at least the timeout: Counting it as such lets a too tight timeout grow again
+    update(entry, entry.timeout, true);
+    return;
+  }
+
+  AdaptiveTimeout::Entry& AdaptiveTimeout::getEntry(std::uint32_t const actuator_id, std::uint8_t const command) {
+    auto it {entries_.find({actuator_id, command})};
+    if (it == entries_.end()) {
+      it = entries_.emplace(std::make_pair(actuator_id, command), Entry{QuantileSketch{}, ceiling_, 0}).first;
+    }
+    return it->second;
+  }
+
+  void AdaptiveTimeout::update(Entry& entry, std::chrono::nanoseconds const& sample, bool const is_forced) {
+    entry.sketch.add(sample);
+    if (entry.sketch.getCount() >= window_) {
+      entry.sketch.decay();
+    }
+    // Evaluating the sketch is more expensive than adding a sample, therefore only do so every couple of samples
+    constexpr std::uint64_t update_interval {16};
+    ++entry.num_pending_samples;
+    if ((entry.sketch.getCount() < min_samples_) || (!is_forced && (entry.num_pending_samples < update_interval))) {
+      return;
+    }
+    entry.num_pending_samples = 0;
+    auto const round_trip_time {std::chrono::duration<double,std::micro>(entry.sketch.getQuantile(quantile_))};
+    auto const timeout {std::chrono::duration_cast<std::chrono::microseconds>(round_trip_time*factor_)};
+    entry.timeout = std::clamp(timeout, floor_, ceiling_);
+    return;
+  }
+
+}
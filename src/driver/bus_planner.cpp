@@ -0,0 +1,85 @@
+#include "myactuator_rmd/driver/bus_planner.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/can/bus_timing.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  double BusPlan::getUtilisation(double const loop_rate) const noexcept {
+    return loop_rate*static_cast<double>(average_bus_time.count())/static_cast<double>(std::nano::den);
+  }
+
+  bool BusPlan::isFeasible(double const loop_rate) const noexcept {
+    return loop_rate <= max_loop_rate;
+  }
+
+  BusPlanner::BusPlanner(CanBaudRate const baud_rate, std::chrono::nanoseconds const& turnaround,
+                         std::chrono::nanoseconds const& host_overhead)
+  : baud_rate_{baud_rate}, turnaround_{turnaround}, host_overhead_{host_overhead}, turnarounds_{} {
+    if ((turnaround.count() < 0) || (host_overhead.count() < 0)) {
+      throw ValueRangeException("Turnaround and host overhead must not be negative");
+    }
+    return;
+  }
+
+  void BusPlanner::setTurnaround(CommandType const command, std::chrono::nanoseconds const& turnaround) {
+    if (turnaround.count() < 0) {
+      throw ValueRangeException("Turnaround must not be negative");
+    }
+    turnarounds_[command] = turnaround;
+    return;
+  }
+
+  std::chrono::nanoseconds BusPlanner::getRoundTripTime(CommandType const command) const noexcept {
+    auto const it {turnarounds_.find(command)};
+    auto const turnaround {(it != turnarounds_.end()) ? it->second : turnaround_};
+    return 2*can::getFrameDuration(baud_rate_) + turnaround + host_overhead_;
+  }
+
+  BusPlan BusPlanner::plan(std::vector<PlannedRequest> const& requests) const {
+    auto const frame_duration {can::getFrameDuration(baud_rate_)};
+    double worst_case_cycle_time {0.0};
+    double average_cycle_time {0.0};
+    double worst_case_bus_time {0.0};
+    double average_bus_time {0.0};
+    std::set<std::uint32_t> setpoint_actuator_ids {};
+    for (auto const& request: requests) {
+      if ((request.actuator_id < 1) || (request.actuator_id > 32)) {
+        throw ValueRangeException("Actuator id '" + std::to_string(request.actuator_id) + "' out of admittable range [1, 32]");
+      }
+      if (request.divider == 0) {
+        throw ValueRangeException("Divider of request has to be positive");
+      }
+      if (isSetpoint(request.command) && !setpoint_actuator_ids.insert(request.actuator_id).second) {
+        throw ValueRangeException("Actuator '" + std::to_string(request.actuator_id) + "' is sent more than one set-point per cycle");
+      }
+      // In the first cycle and every multiple of the least common multiple of the dividers all requests are sent together
+      auto const round_trip_time {static_cast<double>(getRoundTripTime(request.command).count())};
+      auto const bus_time {static_cast<double>(2*frame_duration.count())};
+      worst_case_cycle_time += round_trip_time;
+      average_cycle_time += round_trip_time/request.divider;
+      worst_case_bus_time += bus_time;
+      average_bus_time += bus_time/request.divider;
+    }
+    BusPlan bus_plan {};
+    bus_plan.worst_case_cycle_time = std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(worst_case_cycle_time)};
+    bus_plan.average_cycle_time = std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(average_cycle_time)};
+    bus_plan.worst_case_bus_time = std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(worst_case_bus_time)};
+    bus_plan.average_bus_time = std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(average_bus_time)};
+    bus_plan.max_loop_rate = (worst_case_cycle_time > 0.0) ? std::nano::den/worst_case_cycle_time :
+                                                              std::numeric_limits<double>::infinity();
+    return bus_plan;
+  }
+
+}
@@ -0,0 +1,120 @@
+#include "myactuator_rmd/driver/coalescing_driver.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  CoalescingDriver::CoalescingDriver(Driver& driver, std::chrono::microseconds const& freshness)
+  : Driver{}, driver_{driver}, freshness_{freshness}, mutex_{}, flights_{}, num_forwarded_{0}, num_coalesced_{0},
+    num_cached_{0} {
+    if (freshness < std::chrono::microseconds::zero()) {
+      throw ValueRangeException("Freshness window has to be positive");
+    }
+    return;
+  }
+
+  void CoalescingDriver::addId(std::uint32_t const actuator_id) {
+    driver_.addId(actuator_id);
+    return;
+  }
+
+  void CoalescingDriver::send(Message const& msg, std::uint32_t const actuator_id) {
+    invalidate(actuator_id);
+    num_forwarded_.fetch_add(1, std::memory_order_relaxed);
+    driver_.send(msg, actuator_id);
+    return;
+  }
+
+  std::array<std::uint8_t,8> CoalescingDriver::sendRecv(Message const& request, std::uint32_t const actuator_id) {
+    if (!isReadOnly(static_cast<CommandType>(request.getData()[0]))) {
+      invalidate(actuator_id);
+      num_forwarded_.fetch_add(1, std::memory_order_relaxed);
+      return driver_.sendRecv(request, actuator_id);
+    }
+
+    Key const key {actuator_id, request.getData()};
+    std::unique_lock<std::mutex> lock {mutex_};
+    auto const it {flights_.find(key)};
+    if (it != flights_.end()) {
+      auto const existing_flight {it->second};
+      if (!existing_flight->is_done) {
+        num_coalesced_.fetch_add(1, std::memory_order_relaxed);
+        // Wait for the response without blocking other callers
+        lock.unlock();
+        return existing_flight->response.get();
+      } else if (Clock::now() - existing_flight->completed_at <= freshness_) {
+        num_cached_.fetch_add(1, std::memory_order_relaxed);
+        return existing_flight->response.get();
+      }
+    }
+    auto const flight {std::make_shared<Flight>()};
+    flight->response = flight->promise.get_future().share();
+    flight->is_done = false;
+    flights_[key] = flight;
+    lock.unlock();
+
+    num_forwarded_.fetch_add(1, std::memory_order_relaxed);
+    try {
+      auto const response {driver_.sendRecv(request, actuator_id)};
+      lock.lock();
+      // Flights that were invalidated by a write in the meantime are handed to their callers but never cached
+      auto const flight_it {flights_.find(key)};
+      if ((flight_it != flights_.end()) && (flight_it->second == flight)) {
+        flight->is_done = true;
+        flight->completed_at = Clock::now();
+      }
+      flight->promise.set_value(response);
+      return response;
+    } catch (...) {
+      if (!lock.owns_lock()) {
+        lock.lock();
+      }
+      // Errors are handed to the callers waiting for this flight but never cached
+      flight->promise.set_exception(std::current_exception());
+      auto const flight_it {flights_.find(key)};
+      if ((flight_it != flights_.end()) && (flight_it->second == flight)) {
+        flights_.erase(flight_it);
+      }
+      throw;
+    }
+  }
+
+  std::uint64_t CoalescingDriver::getNumForwarded() const noexcept {
+    return num_forwarded_.load(std::memory_order_relaxed);
+  }
+
+  std::uint64_t CoalescingDriver::getNumCoalesced() const noexcept {
+    return num_coalesced_.load(std::memory_order_relaxed);
+  }
+
+  std::uint64_t CoalescingDriver::getNumCached() const noexcept {
+    return num_cached_.load(std::memory_order_relaxed);
+  }
+
+  void CoalescingDriver::invalidate(std::uint32_t const actuator_id) {
+    std::lock_guard<std::mutex> const lock {mutex_};
+    for (auto it = flights_.begin(); it != flights_.end();) {
+      // Reads in flight might have been issued before the write, their callers hold their own futures
+      if (it->first.first == actuator_id) {
+        it = flights_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return;
+  }
+
+}
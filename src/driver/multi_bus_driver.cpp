@@ -0,0 +1,130 @@
+#include "myactuator_rmd/driver/multi_bus_driver.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "myactuator_rmd/driver/can_driver.hpp"
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/driver/request_priority.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  AddressedMessage::AddressedMessage(BusAddress const& address_, Message const& message_) noexcept
+  : address{address_}, message{message_.getData()} {
+    return;
+  }
+
+  BusConfiguration::BusConfiguration(std::string const& ifname_, std::optional<int> const& cpu_,
+                                     std::chrono::microseconds const& cycle_time_)
+  : ifname{ifname_}, cpu{cpu_}, cycle_time{cycle_time_} {
+    return;
+  }
+
+  MultiBusDriver::MultiBusDriver(std::vector<BusConfiguration> const& buses)
+  : can_drivers_{}, buses_{} {
+    for (auto const& bus: buses) {
+      can_drivers_.emplace_back(std::make_unique<CanDriver>(bus.ifname));
+      buses_.emplace_back(std::make_unique<ThreadSafeDriver>(*can_drivers_.back(), bus.cycle_time, bus.cpu));
+    }
+    return;
+  }
+
+  MultiBusDriver::MultiBusDriver(std::vector<std::reference_wrapper<Driver>> const& drivers,
+                                 std::vector<std::optional<int>> const& cpus)
+  : can_drivers_{}, buses_{} {
+    if (!cpus.empty() && (cpus.size() != drivers.size())) {
+      throw ValueRangeException("Number of CPUs does not match the number of buses");
+    }
+    for (std::size_t i = 0; i < drivers.size(); ++i) {
+      auto const cpu {cpus.empty() ? std::nullopt : cpus[i]};
+      buses_.emplace_back(std::make_unique<ThreadSafeDriver>(drivers[i].get(), std::chrono::microseconds::zero(), cpu));
+    }
+    return;
+  }
+
+  MultiBusDriver::~MultiBusDriver() {
+    // The I/O threads have to be stopped before the drivers they are using are closed
+    buses_.clear();
+    can_drivers_.clear();
+    return;
+  }
+
+  std::size_t MultiBusDriver::getNumBuses() const noexcept {
+    return buses_.size();
+  }
+
+  ThreadSafeDriver& MultiBusDriver::getBus(std::size_t const bus) {
+    if (bus >= buses_.size()) {
+      throw ValueRangeException("Bus index '" + std::to_string(bus) + "' out of range [0, " + std::to_string(buses_.size()) + ")");
+    }
+    return *buses_[bus];
+  }
+
+  void MultiBusDriver::addId(BusAddress const& address) {
+    getBus(address.bus).addId(address.actuator_id);
+    return;
+  }
+
+  void MultiBusDriver::send(Message const& msg, BusAddress const& address) {
+    getBus(address.bus).send(msg, address.actuator_id);
+    return;
+  }
+
+  std::array<std::uint8_t,8> MultiBusDriver::sendRecv(Message const& request, BusAddress const& address) {
+    return getBus(address.bus).sendRecv(request, address.actuator_id);
+  }
+
+  std::vector<std::array<std::uint8_t,8>> MultiBusDriver::sendRecv(std::vector<AddressedMessage> const& requests) {
+    for (auto const& request: requests) {
+      static_cast<void>(getBus(request.address.bus));
+    }
+    // The elements of a deque are never relocated, the bus threads can therefore refer to them
+    std::deque<ThreadSafeDriver::BusRequest> bus_requests {};
+    std::exception_ptr exception {};
+    for (auto const& request: requests) {
+      auto const priority {getRequestPriority(static_cast<CommandType>(request.message.getData()[0]))};
+      auto& bus_request {bus_requests.emplace_back(ThreadSafeDriver::RequestType::SEND_RECV, request.address.actuator_id,
+                                                   request.message, priority)};
+      try {
+        buses_[request.address.bus]->enqueue(bus_request);
+      } catch (...) {
+        // Requests that were already enqueued still have to be waited for before they can be destroyed
+        bus_requests.pop_back();
+        exception = std::current_exception();
+        break;
+      }
+    }
+
+    std::vector<std::array<std::uint8_t,8>> responses {};
+    responses.reserve(bus_requests.size());
+    for (std::size_t i = 0; i < bus_requests.size(); ++i) {
+      try {
+        buses_[requests[i].address.bus]->wait(bus_requests[i]);
+      } catch (...) {
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+      responses.push_back(bus_requests[i].response);
+    }
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+    return responses;
+  }
+
+}
@@ -0,0 +1,357 @@
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+
+#include "myactuator_rmd/concurrency/mpsc_queue.hpp"
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/driver/request_priority.hpp"
+#include "myactuator_rmd/driver/response_listener.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  namespace {
+
+    // Number of the cycle that a request was deferred in if it was never deferred
+    constexpr std::uint64_t not_deferred {std::numeric_limits<std::uint64_t>::max()};
+
+    // Weight of a new sample in the exponential moving average of the request durations
+    constexpr std::chrono::nanoseconds::rep duration_filter_divisor {8};
+
+    /**\fn getPriority
+     * \brief
+     *    Get the default priority of a message from its command byte
+     *
+     * \param[in] msg
+     *    The message to be sent
+     * \return
+     *    The priority class of the message
+    */
+    RequestPriority getPriority(Message const& msg) noexcept {
+      return getRequestPriority(static_cast<CommandType>(msg.getData()[0]));
+    }
+
+  }
+
+  ThreadSafeDriver::BusRequest::BusRequest(RequestType const type_, std::uint32_t const actuator_id_, Message const& message_,
+                                           RequestPriority const priority_)
+  : MpscNode{}, type{type_}, actuator_id{actuator_id_}, message{message_.getData()}, priority{priority_},
+    enqueued_at{}, deferred_cycle{not_deferred}, response{}, exception{}, is_done{}, on_completion{nullptr} {
+    if (::sem_init(&is_done, 0, 0) < 0) {
+      throw std::system_error(errno, std::generic_category(), "Could not initialise request semaphore");
+    }
+    return;
+  }
+
+  ThreadSafeDriver::BusRequest::~BusRequest() {
+    ::sem_destroy(&is_done);
+    return;
+  }
+
+  void ThreadSafeDriver::BusRequest::complete() noexcept {
+    if (on_completion != nullptr) {
+      on_completion(*this);
+    } else {
+      ::sem_post(&is_done);
+    }
+    return;
+  }
+
+  ThreadSafeDriver::ThreadSafeDriver(Driver& driver, std::chrono::microseconds const& cycle_time, std::optional<int> const& cpu)
+  : Driver{}, driver_{driver}, cycle_time_{cycle_time}, start_time_{Clock::now()}, queues_{}, heads_{},
+    estimated_durations_{}, statistics_{}, listeners_{}, num_listeners_{0}, num_pending_{}, is_running_{true}, bus_thread_{} {
+    if (cycle_time < std::chrono::microseconds::zero()) {
+      throw ValueRangeException("Cycle time has to be positive");
+    }
+    if (::sem_init(&num_pending_, 0, 0) < 0) {
+      throw std::system_error(errno, std::generic_category(), "Could not initialise bus semaphore");
+    }
+    bus_thread_ = std::thread(&ThreadSafeDriver::run, this);
+    if (cpu) {
+      ::cpu_set_t cpu_set {};
+      CPU_ZERO(&cpu_set);
+      CPU_SET(*cpu, &cpu_set);
+      int const error {::pthread_setaffinity_np(bus_thread_.native_handle(), sizeof(::cpu_set_t), &cpu_set)};
+      if (error != 0) {
+        stop();
+        throw std::system_error(error, std::generic_category(), "Could not pin bus thread to CPU '" + std::to_string(*cpu) + "'");
+      }
+    }
+    return;
+  }
+
+  ThreadSafeDriver::~ThreadSafeDriver() {
+    stop();
+    return;
+  }
+
+  void ThreadSafeDriver::stop() noexcept {
+    is_running_.store(false, std::memory_order_release);
+    ::sem_post(&num_pending_);
+    if (bus_thread_.joinable()) {
+      bus_thread_.join();
+    }
+    ::sem_destroy(&num_pending_);
+    return;
+  }
+
+  void ThreadSafeDriver::addId(std::uint32_t const actuator_id) {
+    // Does not cost any bus time and should therefore never be deferred
+    BusRequest request {RequestType::ADD_ID, actuator_id, RawMessage{}, RequestPriority::REAL_TIME};
+    submit(request);
+    return;
+  }
+
+  void ThreadSafeDriver::send(Message const& msg, std::uint32_t const actuator_id) {
+    send(msg, actuator_id, getPriority(msg));
+    return;
+  }
+
+  void ThreadSafeDriver::send(Message const& msg, std::uint32_t const actuator_id, RequestPriority const priority) {
+    BusRequest request {RequestType::SEND, actuator_id, msg, priority};
+    submit(request);
+    return;
+  }
+
+  std::array<std::uint8_t,8> ThreadSafeDriver::sendRecv(Message const& request, std::uint32_t const actuator_id) {
+    return sendRecv(request, actuator_id, getPriority(request));
+  }
+
+  std::array<std::uint8_t,8> ThreadSafeDriver::sendRecv(Message const& request, std::uint32_t const actuator_id,
+                                                        RequestPriority const priority) {
+    BusRequest bus_request {RequestType::SEND_RECV, actuator_id, request, priority};
+    submit(bus_request);
+    return bus_request.response;
+  }
+
+  PriorityStatistics ThreadSafeDriver::getStatistics(RequestPriority const priority) const noexcept {
+    auto const& statistics {statistics_[static_cast<std::size_t>(priority)]};
+    return PriorityStatistics{statistics.num_requests.load(std::memory_order_relaxed),
+                              statistics.num_preemptions.load(std::memory_order_relaxed),
+                              statistics.num_deferrals.load(std::memory_order_relaxed),
+                              std::chrono::nanoseconds{statistics.total_waiting_time_ns.load(std::memory_order_relaxed)},
+                              std::chrono::nanoseconds{statistics.max_waiting_time_ns.load(std::memory_order_relaxed)}};
+  }
+
+  void ThreadSafeDriver::addListener(ResponseListener& listener) {
+    auto const i {num_listeners_.fetch_add(1, std::memory_order_relaxed)};
+    if (i >= max_num_listeners) {
+      num_listeners_.fetch_sub(1, std::memory_order_relaxed);
+      throw Exception("Can not register more than " + std::to_string(max_num_listeners) + " listeners");
+    }
+    // The slot is reserved before the listener is published, the bus thread skips slots that are still empty
+    listeners_[i].store(&listener, std::memory_order_release);
+    return;
+  }
+
+  void ThreadSafeDriver::enqueue(BusRequest& request) {
+    if (!is_running_.load(std::memory_order_acquire)) {
+      throw Exception("Thread-safe driver has already been shut down");
+    }
+    request.enqueued_at = Clock::now();
+    queues_[static_cast<std::size_t>(request.priority)].push(&request);
+    ::sem_post(&num_pending_);
+    return;
+  }
+
+  void ThreadSafeDriver::wait(BusRequest& request) {
+    while (::sem_wait(&request.is_done) < 0) {
+      // Only interrupted by a signal, retry
+    }
+    if (request.exception) {
+      std::rethrow_exception(request.exception);
+    }
+    return;
+  }
+
+  void ThreadSafeDriver::submit(BusRequest& request) {
+    enqueue(request);
+    wait(request);
+    return;
+  }
+
+  ThreadSafeDriver::BusRequest* ThreadSafeDriver::selectRequest(Clock::time_point const& now, bool& is_deferred) noexcept {
+    is_deferred = false;
+    for (std::size_t i = 0; i < num_request_priorities; ++i) {
+      if (heads_[i] == nullptr) {
+        heads_[i] = queues_[i].pop();
+      }
+    }
+    for (std::size_t i = 0; i < num_request_priorities; ++i) {
+      BusRequest* const request {heads_[i]};
+      if (request == nullptr) {
+        continue;
+      }
+      if ((i != static_cast<std::size_t>(RequestPriority::REAL_TIME)) && !isWithinBudget(*request, now)) {
+        auto const cycle {getCycle(now)};
+        if (request->deferred_cycle != cycle) {
+          request->deferred_cycle = cycle;
+          statistics_[i].num_deferrals.fetch_add(1, std::memory_order_relaxed);
+        }
+        is_deferred = true;
+        continue;
+      }
+      // Waiting requests of lower classes that were enqueued earlier are overtaken by this one
+      for (std::size_t j = i + 1; j < num_request_priorities; ++j) {
+        if ((heads_[j] != nullptr) && (heads_[j]->enqueued_at < request->enqueued_at)) {
+          statistics_[j].num_preemptions.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+      heads_[i] = nullptr;
+      return request;
+    }
+    return nullptr;
+  }
+
+  bool ThreadSafeDriver::isWithinBudget(BusRequest const& request, Clock::time_point const& now) const noexcept {
+    if (cycle_time_ == std::chrono::nanoseconds::zero()) {
+      return true;
+    }
+    auto const& estimated_duration {estimated_durations_[static_cast<std::size_t>(request.priority)]};
+    // Requests that can never fit into a cycle would otherwise starve
+    if (estimated_duration >= cycle_time_) {
+      return true;
+    }
+    auto const cycle_end {start_time_ + cycle_time_*(getCycle(now) + 1)};
+    return now + estimated_duration <= cycle_end;
+  }
+
+  std::uint64_t ThreadSafeDriver::getCycle(Clock::time_point const& time) const noexcept {
+    if (cycle_time_ == std::chrono::nanoseconds::zero()) {
+      return 0;
+    }
+    return static_cast<std::uint64_t>((time - start_time_)/cycle_time_);
+  }
+
+  bool ThreadSafeDriver::waitUntil(Clock::time_point const& deadline) noexcept {
+    // Semaphores can only wait for an absolute time of the real-time clock
+    auto const remaining {std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now())};
+    if (remaining <= std::chrono::nanoseconds::zero()) {
+      return (::sem_trywait(&num_pending_) == 0);
+    }
+    struct ::timespec timeout {};
+    ::clock_gettime(CLOCK_REALTIME, &timeout);
+    auto const nanoseconds {static_cast<std::chrono::nanoseconds::rep>(timeout.tv_nsec) + remaining.count()};
+    timeout.tv_sec += static_cast<::time_t>(nanoseconds/std::nano::den);
+    timeout.tv_nsec = static_cast<long>(nanoseconds%std::nano::den);
+    return (::sem_timedwait(&num_pending_, &timeout) == 0);
+  }
+
+  void ThreadSafeDriver::process(BusRequest& request) noexcept {
+    auto const start {Clock::now()};
+    try {
+      switch (request.type) {
+        case RequestType::ADD_ID:
+          driver_.addId(request.actuator_id);
+          break;
+        case RequestType::SEND:
+          driver_.send(request.message, request.actuator_id);
+          break;
+        case RequestType::SEND_RECV:
+          request.response = driver_.sendRecv(request.message, request.actuator_id);
+          break;
+      }
+    } catch (...) {
+      request.exception = std::current_exception();
+    }
+    auto const end {Clock::now()};
+    if ((request.type == RequestType::SEND_RECV) && !request.exception) {
+      auto const num_listeners {std::min(num_listeners_.load(std::memory_order_relaxed), max_num_listeners)};
+      for (std::size_t l = 0; l < num_listeners; ++l) {
+        if (auto* const listener {listeners_[l].load(std::memory_order_acquire)}) {
+          listener->onResponse(request.actuator_id, request.response, end);
+        }
+      }
+    }
+
+    auto const i {static_cast<std::size_t>(request.priority)};
+    if (request.type != RequestType::ADD_ID) {
+      auto& estimated_duration {estimated_durations_[i]};
+      auto const duration {std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)};
+      if (estimated_duration == std::chrono::nanoseconds::zero()) {
+        estimated_duration = duration;
+      } else {
+        estimated_duration += (duration - estimated_duration)/duration_filter_divisor;
+      }
+    }
+    auto& statistics {statistics_[i]};
+    auto const waiting_time {std::chrono::duration_cast<std::chrono::nanoseconds>(start - request.enqueued_at).count()};
+    statistics.total_waiting_time_ns.fetch_add(waiting_time, std::memory_order_relaxed);
+    if (waiting_time > statistics.max_waiting_time_ns.load(std::memory_order_relaxed)) {
+      // Only ever written by the bus thread
+      statistics.max_waiting_time_ns.store(waiting_time, std::memory_order_relaxed);
+    }
+    statistics.num_requests.fetch_add(1, std::memory_order_relaxed);
+
+    // The request might be destroyed by its owner as soon as it is signaled
+    request.complete();
+    return;
+  }
+
+  void ThreadSafeDriver::run() noexcept {
+    std::size_t num_available {0};
+    while (true) {
+      if (num_available == 0) {
+        while (::sem_wait(&num_pending_) < 0) {
+          // Only interrupted by a signal, retry
+        }
+        ++num_available;
+      }
+      if (!is_running_.load(std::memory_order_acquire)) {
+        break;
+      }
+      auto const now {Clock::now()};
+      bool is_deferred {false};
+      BusRequest* const request {selectRequest(now, is_deferred)};
+      if (request != nullptr) {
+        process(*request);
+        --num_available;
+      } else if (is_deferred) {
+        // Sleep until the next cycle starts unless a request of a higher class arrives in the meantime
+        if (waitUntil(start_time_ + cycle_time_*(getCycle(now) + 1))) {
+          ++num_available;
+        }
+      } else {
+        // The producer has posted the semaphore but its node is not linked yet
+        std::this_thread::yield();
+      }
+    }
+    // Fail all requests that were enqueued before shutting down
+    auto const fail = [](BusRequest* const request) noexcept {
+      request->exception = std::make_exception_ptr(Exception("Thread-safe driver has been shut down"));
+      request->complete();
+      return;
+    };
+    for (std::size_t i = 0; i < num_request_priorities; ++i) {
+      if (heads_[i] != nullptr) {
+        fail(heads_[i]);
+        heads_[i] = nullptr;
+      }
+      for (BusRequest* request {queues_[i].pop()}; request != nullptr; request = queues_[i].pop()) {
+        fail(request);
+      }
+    }
+    return;
+  }
+
+}
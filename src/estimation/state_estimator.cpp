@@ -0,0 +1,86 @@
+#include "myactuator_rmd/estimation/state_estimator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  StateEstimator::StateEstimator(double const alpha, double const beta, double const speed_weight,
+                                 std::chrono::steady_clock::duration const& min_period)
+  : ResponseListener{}, alpha_{alpha}, beta_{beta}, speed_weight_{speed_weight}, min_period_{min_period}, estimates_{} {
+    if ((alpha_ <= 0.0) || (alpha_ > 1.0)) {
+      throw ValueRangeException("Alpha has to be within (0, 1]");
+    }
+    if ((beta_ < 0.0) || (beta_ >= 2.0)) {
+      throw ValueRangeException("Beta has to be within [0, 2)");
+    }
+    if ((speed_weight_ < 0.0) || (speed_weight_ > 1.0)) {
+      throw ValueRangeException("Speed weight has to be within [0, 1]");
+    }
+    if (min_period_ < std::chrono::steady_clock::duration::zero()) {
+      throw ValueRangeException("Minimum period must not be negative");
+    }
+    return;
+  }
+
+  void StateEstimator::onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                                  std::chrono::steady_clock::time_point const& timestamp) noexcept {
+    if (!isValidId(actuator_id)) {
+      return;
+    }
+    if (isFeedbackResponse(response[0])) {
+      Feedback const feedback {GetMotorStatus2Response::decode(response.data())};
+      update(actuator_id, feedback.shaft_angle, feedback.shaft_speed, timestamp);
+    } else if (response[0] == GetMultiTurnAngleResponse::command) {
+      update(actuator_id, GetMultiTurnAngleResponse::decode(response.data()), std::nullopt, timestamp);
+    }
+    return;
+  }
+
+  std::optional<EstimatedState> StateEstimator::getState(std::uint32_t const actuator_id,
+                                                         std::chrono::steady_clock::time_point const& time) const noexcept {
+    if (!isValidId(actuator_id)) {
+      return std::nullopt;
+    }
+    auto const estimate {estimates_[actuator_id - 1].load()};
+    if (!estimate) {
+      return std::nullopt;
+    }
+    auto const age {time - estimate->timestamp};
+    auto const dt {std::chrono::duration<double>(age).count()};
+    return EstimatedState{estimate->position + estimate->velocity*dt, estimate->velocity, age};
+  }
+
+  void StateEstimator::update(std::uint32_t const actuator_id, double const position, std::optional<double> const& speed,
+                              std::chrono::steady_clock::time_point const& timestamp) noexcept {
+    auto& lock {estimates_[actuator_id - 1]};
+    auto const previous {lock.loadOwned()};
+    Estimate estimate {position, speed.value_or(0.0), timestamp};
+    if (previous) {
+      auto const dt {std::chrono::duration<double>(timestamp - previous->timestamp).count()};
+      // Samples received out of order only correct the position
+      double const predicted_position {previous->position + previous->velocity*std::max(dt, 0.0)};
+      double const residual {position - predicted_position};
+      estimate.position = predicted_position + alpha_*residual;
+      estimate.velocity = (dt > 0.0) ?
+        previous->velocity + beta_*residual/std::max(dt, std::chrono::duration<double>(min_period_).count()) :
+        previous->velocity;
+      if (speed) {
+        estimate.velocity += speed_weight_*(*speed - estimate.velocity);
+      }
+      estimate.timestamp = std::max(timestamp, previous->timestamp);
+    }
+    lock.store(estimate);
+    return;
+  }
+
+}
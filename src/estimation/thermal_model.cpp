@@ -0,0 +1,109 @@
+#include "myactuator_rmd/estimation/thermal_model.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  ThermalModel::ThermalModel(ThermalParameters const& parameters, float const correction_gain,
+                             std::chrono::steady_clock::duration const& correction_period)
+  : ResponseListener{}, parameters_{parameters}, correction_gain_{correction_gain},
+    correction_period_{correction_period}, temperature_rise_per_square_current_{}, states_{} {
+    if ((parameters_.rated_current <= 0.0f) || (parameters_.rated_power <= 0.0f)) {
+      throw ValueRangeException("Rated current and power have to be positive");
+    }
+    if ((parameters_.thermal_resistance <= 0.0f) || (parameters_.time_constant <= 0.0f)) {
+      throw ValueRangeException("Thermal resistance and time constant have to be positive");
+    }
+    if ((parameters_.efficiency < 0.0f) || (parameters_.efficiency > 1.0f)) {
+      throw ValueRangeException("Efficiency has to be within [0, 1]");
+    }
+    if ((correction_gain_ <= 0.0f) || (correction_gain_ > 1.0f)) {
+      throw ValueRangeException("Correction gain has to be within (0, 1]");
+    }
+    if (correction_period_ < std::chrono::steady_clock::duration::zero()) {
+      throw ValueRangeException("Correction period must not be negative");
+    }
+    auto const rated_losses {(1.0f - parameters_.efficiency)*parameters_.rated_power};
+    temperature_rise_per_square_current_ = parameters_.thermal_resistance*rated_losses/
+                                           (parameters_.rated_current*parameters_.rated_current);
+    return;
+  }
+
+  void ThermalModel::onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                                std::chrono::steady_clock::time_point const& timestamp) noexcept {
+    if (!isValidId(actuator_id)) {
+      return;
+    }
+    auto const is_feedback {isFeedbackResponse(response[0])};
+    auto const is_status {response[0] == GetMotorStatus1Response::command};
+    if (!is_feedback && !is_status) {
+      return;
+    }
+    std::optional<Feedback> feedback {};
+    float measured_temperature {};
+    if (is_feedback) {
+      feedback = GetMotorStatus2Response::decode(response.data());
+      measured_temperature = static_cast<float>(feedback->temperature);
+    } else {
+      measured_temperature = static_cast<float>(GetMotorStatus1Response::decode(response.data()).temperature);
+    }
+    auto& lock {states_[actuator_id - 1]};
+    auto const previous {lock.loadOwned()};
+    if (!previous) {
+      // The actuator is assumed to be in equilibrium with its surroundings when it is first seen
+      auto const current {feedback ? feedback->current : 0.0f};
+      lock.store(State{measured_temperature, measured_temperature, current, timestamp, timestamp});
+      return;
+    }
+    State state {*previous};
+    state.temperature = predict(previous->temperature, previous->ambient_temperature, previous->current,
+                                timestamp - previous->timestamp);
+    state.timestamp = timestamp;
+    if (feedback) {
+      state.current = feedback->current;
+    }
+    if (is_status || (timestamp - state.correction_timestamp >= correction_period_)) {
+      // Deviations that persist are attributed to the ambient temperature
+      auto const residual {measured_temperature - state.temperature};
+      state.temperature += correction_gain_*residual;
+      state.ambient_temperature += correction_gain_*residual;
+      state.correction_timestamp = timestamp;
+    }
+    lock.store(state);
+    return;
+  }
+
+  std::optional<float> ThermalModel::getTemperature(std::uint32_t const actuator_id,
+                                                    std::chrono::steady_clock::time_point const& time) const noexcept {
+    if (!isValidId(actuator_id)) {
+      return std::nullopt;
+    }
+    auto const state {states_[actuator_id - 1].load()};
+    if (!state) {
+      return std::nullopt;
+    }
+    return predict(state->temperature, state->ambient_temperature, state->current, time - state->timestamp);
+  }
+
+  float ThermalModel::predict(float const temperature, float const ambient_temperature, float const current,
+                              std::chrono::steady_clock::duration const& dt) const noexcept {
+    if (dt <= std::chrono::steady_clock::duration::zero()) {
+      return temperature;
+    }
+    auto const steady_state_temperature {ambient_temperature + temperature_rise_per_square_current_*current*current};
+    auto const decay {std::exp(-std::chrono::duration<float>(dt).count()/parameters_.time_constant)};
+    return steady_state_temperature + (temperature - steady_state_temperature)*decay;
+  }
+
+}
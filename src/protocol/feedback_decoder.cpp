@@ -0,0 +1,53 @@
+#include "myactuator_rmd/protocol/feedback_decoder.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+
+  void decodeFeedback(std::array<std::uint8_t,8> const* data, std::size_t const num_responses,
+                      FeedbackArrays const& feedback) noexcept {
+    std::size_t i {0};
+  #if defined(__SSE2__)
+    static_assert(sizeof(int) == sizeof(std::int32_t), "Temperatures are stored as 32-bit integers");
+    __m128 const current_resolution {_mm_set1_ps(0.01f)};
+    for (; i + 4 <= num_responses; i += 4) {
+      // Each response consists of two 32-bit words: [command, temperature, current] and [speed, angle]
+      __m128i const responses_01 {_mm_loadu_si128(reinterpret_cast<__m128i const*>(data[i].data()))};
+      __m128i const responses_23 {_mm_loadu_si128(reinterpret_cast<__m128i const*>(data[i+2].data()))};
+      __m128i const words_02 {_mm_unpacklo_epi32(responses_01, responses_23)};
+      __m128i const words_13 {_mm_unpackhi_epi32(responses_01, responses_23)};
+      __m128i const first_words {_mm_unpacklo_epi32(words_02, words_13)};
+      __m128i const second_words {_mm_unpackhi_epi32(words_02, words_13)};
+      // Sign-extend the individual fields by arithmetic shifts
+      __m128i const temperature {_mm_srai_epi32(_mm_slli_epi32(first_words, 16), 24)};
+      __m128i const current {_mm_srai_epi32(first_words, 16)};
+      __m128i const shaft_speed {_mm_srai_epi32(_mm_slli_epi32(second_words, 16), 16)};
+      __m128i const shaft_angle {_mm_srai_epi32(second_words, 16)};
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(feedback.temperature + i), temperature);
+      _mm_storeu_ps(feedback.current + i, _mm_mul_ps(_mm_cvtepi32_ps(current), current_resolution));
+      _mm_storeu_ps(feedback.shaft_speed + i, _mm_cvtepi32_ps(shaft_speed));
+      _mm_storeu_ps(feedback.shaft_angle + i, _mm_cvtepi32_ps(shaft_angle));
+    }
+  #endif
+    for (; i < num_responses; ++i) {
+      // All feedback responses share the same layout
+      Feedback const f {GetMotorStatus2Response::decode(data[i].data())};
+      feedback.temperature[i] = f.temperature;
+      feedback.current[i] = f.current;
+      feedback.shaft_speed[i] = f.shaft_speed;
+      feedback.shaft_angle[i] = f.shaft_angle;
+    }
+    return;
+  }
+
+}
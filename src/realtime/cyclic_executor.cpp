@@ -0,0 +1,216 @@
+#include "myactuator_rmd/realtime/cyclic_executor.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <future>
+#include <ratio>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  namespace {
+
+    // Size of the stack that is touched before the first cycle
+    constexpr std::size_t prefault_stack_size {64*1024};
+
+    /**\fn now
+     * \brief
+     *    Get the current time of the monotonic clock
+     *
+     * \return
+     *    The current time in nanoseconds
+    */
+    std::int64_t now() noexcept {
+      struct ::timespec time {};
+      ::clock_gettime(CLOCK_MONOTONIC, &time);
+      return static_cast<std::int64_t>(time.tv_sec)*std::nano::den + time.tv_nsec;
+    }
+
+    /**\fn sleepUntil
+     * \brief
+     *    Sleeps until an absolute time of the monotonic clock
+     *
+     * \param[in] time
+     *    The wake-up time in nanoseconds
+    */
+    void sleepUntil(std::int64_t const time) noexcept {
+      struct ::timespec wake_up {};
+      wake_up.tv_sec = static_cast<::time_t>(time/std::nano::den);
+      wake_up.tv_nsec = static_cast<long>(time%std::nano::den);
+      while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake_up, nullptr) == EINTR) {
+        // Only interrupted by a signal, retry
+      }
+      return;
+    }
+
+    /**\fn prefaultStack
+     * \brief
+     *    Touches the stack so that its pages are mapped before the first cycle
+    */
+    void prefaultStack() noexcept {
+      unsigned char stack[prefault_stack_size];
+      std::memset(stack, 0, sizeof(stack));
+      // Compiler barrier so that the writes to the otherwise unused array are not optimised away
+      asm volatile("" : : "r"(stack) : "memory");
+      return;
+    }
+
+    /**\fn updateMax
+     * \brief
+     *    Stores the value if it is larger than the current maximum, only called from a single writer
+     *
+     * \param[in,out] max
+     *    The current maximum
+     * \param[in] value
+     *    The new value
+    */
+    void updateMax(std::atomic<std::int64_t>& max, std::int64_t const value) noexcept {
+      if (value > max.load(std::memory_order_relaxed)) {
+        max.store(value, std::memory_order_relaxed);
+      }
+      return;
+    }
+
+  }
+
+  CyclicExecutor::CyclicExecutor(std::function<void()> const& callback, ExecutorConfiguration const& configuration)
+  : callback_{callback}, configuration_{configuration}, num_cycles_{0}, num_deadline_misses_{0}, num_skipped_cycles_{0},
+    num_errors_{0}, total_wake_up_latency_ns_{0}, max_wake_up_latency_ns_{0}, total_execution_time_ns_{0},
+    max_execution_time_ns_{0}, is_running_{true}, thread_{} {
+    if (configuration.period <= std::chrono::nanoseconds::zero()) {
+      throw ValueRangeException("Period of the cyclic executor has to be positive");
+    }
+    if (!callback) {
+      throw ValueRangeException("Callback of the cyclic executor is empty");
+    }
+    std::promise<void> is_configured {};
+    auto configuration_result {is_configured.get_future()};
+    thread_ = std::thread(&CyclicExecutor::run, this, std::move(is_configured));
+    try {
+      configuration_result.get();
+    } catch (...) {
+      thread_.join();
+      throw;
+    }
+    return;
+  }
+
+  CyclicExecutor::~CyclicExecutor() {
+    stop();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    return;
+  }
+
+  void CyclicExecutor::stop() noexcept {
+    is_running_.store(false, std::memory_order_release);
+    return;
+  }
+
+  bool CyclicExecutor::isRunning() const noexcept {
+    return is_running_.load(std::memory_order_acquire);
+  }
+
+  ExecutorStatistics CyclicExecutor::getStatistics() const noexcept {
+    return ExecutorStatistics{num_cycles_.load(std::memory_order_relaxed),
+                              num_deadline_misses_.load(std::memory_order_relaxed),
+                              num_skipped_cycles_.load(std::memory_order_relaxed),
+                              num_errors_.load(std::memory_order_relaxed),
+                              std::chrono::nanoseconds{total_wake_up_latency_ns_.load(std::memory_order_relaxed)},
+                              std::chrono::nanoseconds{max_wake_up_latency_ns_.load(std::memory_order_relaxed)},
+                              std::chrono::nanoseconds{total_execution_time_ns_.load(std::memory_order_relaxed)},
+                              std::chrono::nanoseconds{max_execution_time_ns_.load(std::memory_order_relaxed)}};
+  }
+
+  void CyclicExecutor::configure() const {
+    if (configuration_.cpu) {
+      ::cpu_set_t cpu_set {};
+      CPU_ZERO(&cpu_set);
+      CPU_SET(*configuration_.cpu, &cpu_set);
+      int const error {::pthread_setaffinity_np(::pthread_self(), sizeof(::cpu_set_t), &cpu_set)};
+      if (error != 0) {
+        throw std::system_error(error, std::generic_category(), "Could not pin executor to CPU '" + std::to_string(*configuration_.cpu) + "'");
+      }
+    }
+    if (configuration_.priority) {
+      struct ::sched_param param {};
+      param.sched_priority = *configuration_.priority;
+      int const error {::pthread_setschedparam(::pthread_self(), SCHED_FIFO, &param)};
+      if (error != 0) {
+        throw std::system_error(error, std::generic_category(), "Could not set SCHED_FIFO priority '" + std::to_string(*configuration_.priority) + "'");
+      }
+    }
+    if (configuration_.is_lock_memory) {
+      if (::mlockall(MCL_CURRENT | MCL_FUTURE) < 0) {
+        throw std::system_error(errno, std::generic_category(), "Could not lock memory");
+      }
+    }
+    if (configuration_.is_prefault_stack) {
+      prefaultStack();
+    }
+    return;
+  }
+
+  void CyclicExecutor::run(std::promise<void> is_configured) noexcept {
+    try {
+      configure();
+    } catch (...) {
+      is_running_.store(false, std::memory_order_release);
+      is_configured.set_exception(std::current_exception());
+      return;
+    }
+    is_configured.set_value();
+
+    auto const period {static_cast<std::int64_t>(configuration_.period.count())};
+    std::int64_t wake_up {now()};
+    while (true) {
+      wake_up += period;
+      sleepUntil(wake_up);
+      auto const start {now()};
+      if (!is_running_.load(std::memory_order_acquire)) {
+        break;
+      }
+      try {
+        callback_();
+      } catch (...) {
+        num_errors_.fetch_add(1, std::memory_order_relaxed);
+      }
+      auto const end {now()};
+
+      auto const wake_up_latency {start - wake_up};
+      auto const execution_time {end - start};
+      total_wake_up_latency_ns_.fetch_add(wake_up_latency, std::memory_order_relaxed);
+      updateMax(max_wake_up_latency_ns_, wake_up_latency);
+      total_execution_time_ns_.fetch_add(execution_time, std::memory_order_relaxed);
+      updateMax(max_execution_time_ns_, execution_time);
+      num_cycles_.fetch_add(1, std::memory_order_relaxed);
+      auto const overrun {end - wake_up};
+      if (overrun >= period) {
+        num_deadline_misses_.fetch_add(1, std::memory_order_relaxed);
+        // Skip the wake-up times that have already passed instead of catching up with a burst of cycles
+        auto const num_skipped {overrun/period};
+        num_skipped_cycles_.fetch_add(static_cast<std::uint64_t>(num_skipped), std::memory_order_relaxed);
+        wake_up += num_skipped*period;
+      }
+    }
+    return;
+  }
+
+}
@@ -0,0 +1,167 @@
+#include "myactuator_rmd/telemetry/feedback_batch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <vector>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+
+  namespace {
+
+    /**\fn carve
+     * \brief
+     *    Value-initialises an array at the given offset of the storage and advances the offset past it
+     *
+     * \tparam T
+     *    The type of the elements of the array
+     * \param[in] storage
+     *    The storage holding all arrays
+     * \param[in,out] offset
+     *    The offset of the array in bytes
+     * \param[in] capacity
+     *    The number of elements of the array
+     * \return
+     *    The first element of the array
+    */
+    template <typename T>
+    T* carve(std::byte* const storage, std::size_t& offset, std::size_t const capacity) noexcept {
+      auto* const first {reinterpret_cast<T*>(storage + offset)};
+      std::uninitialized_value_construct_n(first, capacity);
+      offset += capacity*sizeof(T);
+      return first;
+    }
+
+  }
+
+  void FeedbackBatch::AlignedDeleter::operator() (std::byte* const storage) const noexcept {
+    ::operator delete[](storage, std::align_val_t{alignment});
+    return;
+  }
+
+  FeedbackBatch::FeedbackBatch(std::vector<std::uint32_t> const& actuator_ids)
+  : actuator_ids_{actuator_ids}, capacity_{}, storage_{}, temperature_{}, current_{}, shaft_speed_{},
+    shaft_angle_{}, timestamps_{}, valid_{} {
+    // The validity flags are a single byte each, padding them to the alignment keeps all other arrays aligned as well
+    capacity_ = std::max<std::size_t>((actuator_ids_.size() + alignment - 1)/alignment*alignment, alignment);
+    auto const num_bytes {capacity_*(sizeof(int) + 3*sizeof(float) + sizeof(std::chrono::steady_clock::time_point) +
+                                     sizeof(std::uint8_t))};
+    storage_.reset(static_cast<std::byte*>(::operator new[](num_bytes, std::align_val_t{alignment})));
+    std::size_t offset {0};
+    temperature_ = carve<int>(storage_.get(), offset, capacity_);
+    current_ = carve<float>(storage_.get(), offset, capacity_);
+    shaft_speed_ = carve<float>(storage_.get(), offset, capacity_);
+    shaft_angle_ = carve<float>(storage_.get(), offset, capacity_);
+    timestamps_ = carve<std::chrono::steady_clock::time_point>(storage_.get(), offset, capacity_);
+    valid_ = carve<std::uint8_t>(storage_.get(), offset, capacity_);
+    return;
+  }
+
+  bool FeedbackBatch::update(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                             std::chrono::steady_clock::time_point const& timestamp) noexcept {
+    return update(actuator_id, response.data(), timestamp);
+  }
+
+  bool FeedbackBatch::update(std::uint32_t const actuator_id, std::uint8_t const* response,
+                             std::chrono::steady_clock::time_point const& timestamp) noexcept {
+    if (!isFeedbackResponse(response[0])) {
+      return false;
+    }
+    auto const index {getIndex(actuator_id)};
+    if (!index) {
+      return false;
+    }
+    auto const i {*index};
+    Feedback const feedback {GetMotorStatus2Response::decode(response)};
+    temperature_[i] = feedback.temperature;
+    current_[i] = feedback.current;
+    shaft_speed_[i] = feedback.shaft_speed;
+    shaft_angle_[i] = feedback.shaft_angle;
+    timestamps_[i] = timestamp;
+    valid_[i] = 1;
+    return true;
+  }
+
+  void FeedbackBatch::invalidate() noexcept {
+    std::fill_n(valid_, capacity_, std::uint8_t{0});
+    return;
+  }
+
+  void FeedbackBatch::invalidateOlderThan(std::chrono::steady_clock::duration const& max_age,
+                                          std::chrono::steady_clock::time_point const& now) noexcept {
+    for (std::size_t i = 0; i < actuator_ids_.size(); ++i) {
+      if (now - timestamps_[i] > max_age) {
+        valid_[i] = 0;
+      }
+    }
+    return;
+  }
+
+  bool FeedbackBatch::isComplete() const noexcept {
+    return std::all_of(valid_, valid_ + actuator_ids_.size(), [](std::uint8_t const v) { return v != 0; });
+  }
+
+  std::optional<std::size_t> FeedbackBatch::getIndex(std::uint32_t const actuator_id) const noexcept {
+    auto const it {std::find(actuator_ids_.begin(), actuator_ids_.end(), actuator_id)};
+    if (it == actuator_ids_.end()) {
+      return std::nullopt;
+    }
+    return static_cast<std::size_t>(std::distance(actuator_ids_.begin(), it));
+  }
+
+  Feedback FeedbackBatch::getFeedback(std::size_t const index) const noexcept {
+    return Feedback{temperature_[index], current_[index], shaft_speed_[index], shaft_angle_[index]};
+  }
+
+  std::chrono::steady_clock::duration FeedbackBatch::getAge(std::size_t const index,
+                                                            std::chrono::steady_clock::time_point const& now) const noexcept {
+    return now - timestamps_[index];
+  }
+
+  std::size_t FeedbackBatch::size() const noexcept {
+    return actuator_ids_.size();
+  }
+
+  std::size_t FeedbackBatch::getCapacity() const noexcept {
+    return capacity_;
+  }
+
+  std::vector<std::uint32_t> const& FeedbackBatch::getActuatorIds() const noexcept {
+    return actuator_ids_;
+  }
+
+  int const* FeedbackBatch::getTemperature() const noexcept {
+    return temperature_;
+  }
+
+  float const* FeedbackBatch::getCurrent() const noexcept {
+    return current_;
+  }
+
+  float const* FeedbackBatch::getShaftSpeed() const noexcept {
+    return shaft_speed_;
+  }
+
+  float const* FeedbackBatch::getShaftAngle() const noexcept {
+    return shaft_angle_;
+  }
+
+  std::uint8_t const* FeedbackBatch::getValid() const noexcept {
+    return valid_;
+  }
+
+  std::chrono::steady_clock::time_point const* FeedbackBatch::getTimestamps() const noexcept {
+    return timestamps_;
+  }
+
+}
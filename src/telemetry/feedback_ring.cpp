@@ -0,0 +1,84 @@
+#include "myactuator_rmd/telemetry/feedback_ring.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/telemetry/stamped_response.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  StampedFeedback::StampedFeedback(Feedback const& feedback_, std::chrono::steady_clock::time_point const& timestamp_) noexcept
+  : feedback{feedback_}, timestamp{timestamp_} {
+    return;
+  }
+
+  FeedbackRing::FeedbackRing(std::size_t const capacity)
+  : ResponseListener{}, capacity_{capacity}, rings_{} {
+    if (capacity_ == 0) {
+      throw ValueRangeException("Capacity of the feedback ring has to be positive");
+    }
+    for (auto& ring: rings_) {
+      ring.entries = std::make_unique<Entry[]>(capacity_);
+    }
+    return;
+  }
+
+  void FeedbackRing::onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                                std::chrono::steady_clock::time_point const& timestamp) noexcept {
+    if (!isFeedbackResponse(response[0]) || !isValidId(actuator_id)) {
+      return;
+    }
+    auto& ring {rings_[actuator_id - 1]};
+    auto const i {ring.head.load(std::memory_order_relaxed)};
+    ring.entries[i % capacity_].store(StampedResponse{response, timestamp}, i + 1);
+    ring.head.store(i + 1, std::memory_order_release);
+    return;
+  }
+
+  std::size_t FeedbackRing::getLatest(std::uint32_t const actuator_id, StampedFeedback* samples,
+                                      std::size_t const num_samples) const noexcept {
+    if (!isValidId(actuator_id)) {
+      return 0;
+    }
+    auto const& ring {rings_[actuator_id - 1]};
+    auto const head {ring.head.load(std::memory_order_acquire)};
+    auto const num_requested {static_cast<std::size_t>(std::min<std::uint64_t>({num_samples, capacity_, head}))};
+    // Copied from the most recent entry backwards as the writer overwrites the oldest entries first
+    std::size_t num_copied {0};
+    for (; num_copied < num_requested; ++num_copied) {
+      auto const i {head - 1 - num_copied};
+      auto const entry {ring.entries[i % capacity_].load(i + 1)};
+      if (!entry) {
+        break;
+      }
+      samples[num_requested - 1 - num_copied] = StampedFeedback{GetMotorStatus2Response::decode(entry->data.data()),
+                                                                entry->timestamp};
+    }
+    if (num_copied < num_requested) {
+      std::move(samples + num_requested - num_copied, samples + num_requested, samples);
+    }
+    return num_copied;
+  }
+
+  std::uint64_t FeedbackRing::getCount(std::uint32_t const actuator_id) const noexcept {
+    if (!isValidId(actuator_id)) {
+      return 0;
+    }
+    return rings_[actuator_id - 1].head.load(std::memory_order_acquire);
+  }
+
+  std::size_t FeedbackRing::getCapacity() const noexcept {
+    return capacity_;
+  }
+
+}
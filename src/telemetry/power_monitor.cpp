@@ -0,0 +1,119 @@
+#include "myactuator_rmd/telemetry/power_monitor.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/driver/seq_lock.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  PowerMonitor::PowerMonitor(float const torque_constant, float const resistance,
+                             std::chrono::steady_clock::duration const& window)
+  : ResponseListener{}, torque_constant_{torque_constant}, resistance_{resistance}, window_{window}, accumulators_{} {
+    if (torque_constant_ <= 0.0f) {
+      throw ValueRangeException("Torque constant has to be positive");
+    }
+    if (resistance_ < 0.0f) {
+      throw ValueRangeException("Resistance must not be negative");
+    }
+    if (window_ <= std::chrono::steady_clock::duration::zero()) {
+      throw ValueRangeException("Window has to be positive");
+    }
+    return;
+  }
+
+  void PowerMonitor::onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                                std::chrono::steady_clock::time_point const& timestamp) noexcept {
+    if (!isValidId(actuator_id)) {
+      return;
+    }
+    auto const is_feedback {isFeedbackResponse(response[0])};
+    auto const is_status {response[0] == GetMotorStatus1Response::command};
+    if (!is_feedback && !is_status) {
+      return;
+    }
+    auto& lock {accumulators_[actuator_id - 1]};
+    auto const previous {lock.loadOwned()};
+    Accumulator accumulator {0.0f, 0.0f, 0.0f, 0.0f, 0.0, 0.0, timestamp, timestamp};
+    if (previous) {
+      accumulator = *previous;
+      // Samples received out of order do not add any energy
+      if (timestamp > previous->timestamp) {
+        auto const dt {std::chrono::duration<double>(timestamp - previous->timestamp).count()};
+        accumulator.energy += getPower(previous->current, previous->shaft_speed)*dt;
+        accumulator.timestamp = timestamp;
+      }
+    }
+    if (is_feedback) {
+      Feedback const feedback {GetMotorStatus2Response::decode(response.data())};
+      accumulator.current = feedback.current;
+      accumulator.shaft_speed = feedback.shaft_speed;
+    } else {
+      accumulator.voltage = GetMotorStatus1Response::decode(response.data()).voltage;
+    }
+    if (accumulator.timestamp - accumulator.window_start >= window_) {
+      auto const window_duration {std::chrono::duration<double>(accumulator.timestamp - accumulator.window_start).count()};
+      accumulator.average_power = static_cast<float>((accumulator.energy - accumulator.window_energy)/window_duration);
+      accumulator.window_energy = accumulator.energy;
+      accumulator.window_start = accumulator.timestamp;
+    }
+    lock.store(accumulator);
+    return;
+  }
+
+  std::optional<PowerState> PowerMonitor::getPowerState(std::uint32_t const actuator_id) const noexcept {
+    if (!isValidId(actuator_id)) {
+      return std::nullopt;
+    }
+    auto const accumulator {accumulators_[actuator_id - 1].load()};
+    if (!accumulator) {
+      return std::nullopt;
+    }
+    return toPowerState(*accumulator);
+  }
+
+  PowerState PowerMonitor::getTotalPowerState() const noexcept {
+    PowerState total {};
+    std::size_t num_voltages {0};
+    for (auto const& lock: accumulators_) {
+      auto const accumulator {lock.load()};
+      if (!accumulator) {
+        continue;
+      }
+      auto const state {toPowerState(*accumulator)};
+      if (state.voltage > 0.0f) {
+        total.voltage += state.voltage;
+        ++num_voltages;
+      }
+      total.current += state.current;
+      total.power += state.power;
+      total.average_power += state.average_power;
+      total.energy += state.energy;
+    }
+    if (num_voltages > 0) {
+      total.voltage /= static_cast<float>(num_voltages);
+    }
+    return total;
+  }
+
+  float PowerMonitor::getPower(float const current, float const shaft_speed) const noexcept {
+    constexpr float pi {3.14159265358979f};
+    auto const angular_velocity {shaft_speed*pi/180.0f};
+    return torque_constant_*std::abs(current*angular_velocity) + resistance_*current*current;
+  }
+
+  PowerState PowerMonitor::toPowerState(Accumulator const& accumulator) const noexcept {
+    auto const power {getPower(accumulator.current, accumulator.shaft_speed)};
+    auto const current {(accumulator.voltage > 0.0f) ? power/accumulator.voltage : 0.0f};
+    return PowerState{accumulator.voltage, current, power, accumulator.average_power, accumulator.energy};
+  }
+
+}
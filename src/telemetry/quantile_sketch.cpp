@@ -0,0 +1,90 @@
+#include "myactuator_rmd/telemetry/quantile_sketch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  QuantileSketch::QuantileSketch(double const relative_accuracy, std::chrono::nanoseconds const& min_value,
+                                 std::chrono::nanoseconds const& max_value)
+  : gamma_{}, log_gamma_{}, min_value_{}, buckets_{}, count_{0.0} {
+    if ((relative_accuracy <= 0.0) || (relative_accuracy >= 1.0)) {
+      throw ValueRangeException("Relative accuracy '" + std::to_string(relative_accuracy) + "' out of range ]0, 1[");
+    }
+    if ((min_value.count() <= 0) || (max_value <= min_value)) {
+      throw ValueRangeException("Invalid range of durations for quantile sketch");
+    }
+    // Each bucket [min*gamma^(i-1), min*gamma^i[ is represented by a value that is off by at most the relative accuracy
+    gamma_ = (1.0 + relative_accuracy)/(1.0 - relative_accuracy);
+    log_gamma_ = std::log(gamma_);
+    min_value_ = static_cast<double>(min_value.count());
+    auto const num_buckets {static_cast<std::size_t>(std::ceil(std::log(static_cast<double>(max_value.count())/min_value_)/log_gamma_)) + 1};
+    buckets_.resize(num_buckets, 0.0);
+    return;
+  }
+
+  void QuantileSketch::add(std::chrono::nanoseconds const& value) noexcept {
+    buckets_[getIndex(static_cast<double>(value.count()))] += 1.0;
+    count_ += 1.0;
+    return;
+  }
+
+  std::chrono::nanoseconds QuantileSketch::getQuantile(double const quantile) const noexcept {
+    if (count_ <= 0.0) {
+      return std::chrono::nanoseconds::zero();
+    }
+    auto const rank {std::clamp(quantile, 0.0, 1.0)*std::max(count_ - 1.0, 0.0)};
+    double cumulative_count {0.0};
+    std::size_t i {0};
+    for (; i < buckets_.size(); ++i) {
+      cumulative_count += buckets_[i];
+      if (cumulative_count > rank) {
+        break;
+      }
+    }
+    i = std::min(i, buckets_.size() - 1);
+    if (i == 0) {
+      return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(min_value_)};
+    }
+    // Representative value of the bucket with equal relative distance to both of its bounds
+    double const value {2.0*min_value_*std::pow(gamma_, static_cast<double>(i))/(gamma_ + 1.0)};
+    return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(value)};
+  }
+
+  std::uint64_t QuantileSketch::getCount() const noexcept {
+    return static_cast<std::uint64_t>(std::llround(count_));
+  }
+
+  void QuantileSketch::decay() noexcept {
+    // Weights are fractional so that sparse buckets in the tail survive: Halving a count of one would erase them
+    count_ = 0.0;
+    for (auto& bucket: buckets_) {
+      bucket *= 0.5;
+      count_ += bucket;
+    }
+    return;
+  }
+
+  void QuantileSketch::clear() noexcept {
+    std::fill(buckets_.begin(), buckets_.end(), 0.0);
+    count_ = 0.0;
+    return;
+  }
+
+  std::size_t QuantileSketch::getIndex(double const value) const noexcept {
+    if (value <= min_value_) {
+      return 0;
+    }
+    auto const index {static_cast<std::size_t>(std::ceil(std::log(value/min_value_)/log_gamma_))};
+    return std::min(index, buckets_.size() - 1);
+  }
+
+}
@@ -0,0 +1,99 @@
+#include "myactuator_rmd/telemetry/state_cache.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/telemetry/stamped_response.hpp"
+
+
+namespace myactuator_rmd {
+
+  void StateCache::onResponse(std::uint32_t const actuator_id, std::array<std::uint8_t,8> const& response,
+                              std::chrono::steady_clock::time_point const& timestamp) noexcept {
+    auto const kind {getSlotKind(response[0])};
+    if (!kind || !isValidId(actuator_id)) {
+      return;
+    }
+    slots_[actuator_id - 1][static_cast<std::size_t>(*kind)].store(StampedResponse{response, timestamp});
+    return;
+  }
+
+  std::optional<StampedResponse> StateCache::getResponse(std::uint32_t const actuator_id, CommandType const command) const noexcept {
+    auto const kind {getSlotKind(static_cast<std::uint8_t>(command))};
+    if (!kind) {
+      return std::nullopt;
+    }
+    return read(actuator_id, *kind);
+  }
+
+  std::optional<Feedback> StateCache::getFeedback(std::uint32_t const actuator_id) const noexcept {
+    auto const response {read(actuator_id, SlotKind::FEEDBACK)};
+    if (!response) {
+      return std::nullopt;
+    }
+    return GetMotorStatus2Response::decode(response->data.data());
+  }
+
+  std::optional<MotorStatus1> StateCache::getMotorStatus1(std::uint32_t const actuator_id) const noexcept {
+    auto const response {read(actuator_id, SlotKind::MOTOR_STATUS_1)};
+    if (!response) {
+      return std::nullopt;
+    }
+    return GetMotorStatus1Response::decode(response->data.data());
+  }
+
+  std::optional<MotorStatus3> StateCache::getMotorStatus3(std::uint32_t const actuator_id) const noexcept {
+    auto const response {read(actuator_id, SlotKind::MOTOR_STATUS_3)};
+    if (!response) {
+      return std::nullopt;
+    }
+    return GetMotorStatus3Response::decode(response->data.data());
+  }
+
+  std::optional<float> StateCache::getMultiTurnAngle(std::uint32_t const actuator_id) const noexcept {
+    auto const response {read(actuator_id, SlotKind::MULTI_TURN_ANGLE)};
+    if (!response) {
+      return std::nullopt;
+    }
+    return GetMultiTurnAngleResponse::decode(response->data.data());
+  }
+
+  std::optional<float> StateCache::getSingleTurnAngle(std::uint32_t const actuator_id) const noexcept {
+    auto const response {read(actuator_id, SlotKind::SINGLE_TURN_ANGLE)};
+    if (!response) {
+      return std::nullopt;
+    }
+    return GetSingleTurnAngleResponse::decode(response->data.data());
+  }
+
+  std::optional<StateCache::SlotKind> StateCache::getSlotKind(std::uint8_t const command) noexcept {
+    if (isFeedbackResponse(command)) {
+      return SlotKind::FEEDBACK;
+    } else if (command == GetMotorStatus1Response::command) {
+      return SlotKind::MOTOR_STATUS_1;
+    } else if (command == GetMotorStatus3Response::command) {
+      return SlotKind::MOTOR_STATUS_3;
+    } else if (command == GetMultiTurnAngleResponse::command) {
+      return SlotKind::MULTI_TURN_ANGLE;
+    } else if (command == GetSingleTurnAngleResponse::command) {
+      return SlotKind::SINGLE_TURN_ANGLE;
+    }
+    return std::nullopt;
+  }
+
+  std::optional<StampedResponse> StateCache::read(std::uint32_t const actuator_id, SlotKind const kind) const noexcept {
+    if (!isValidId(actuator_id)) {
+      return std::nullopt;
+    }
+    return slots_[actuator_id - 1][static_cast<std::size_t>(kind)].load();
+  }
+
+}
@@ -0,0 +1,90 @@
+#include "myactuator_rmd/telemetry/state_history.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_3.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+
+  void StateHistory::push(std::array<std::uint8_t,8> const& response,
+                          std::chrono::steady_clock::time_point const& timestamp) {
+    if (!segments_.empty() && (timestamp >= segments_.back().start)) {
+      auto const offset {std::chrono::duration_cast<std::chrono::microseconds>(timestamp - segments_.back().start)};
+      if (offset.count() <= std::numeric_limits<std::uint32_t>::max()) {
+        records_.emplace_back(response, static_cast<std::uint32_t>(offset.count()));
+        return;
+      }
+    }
+    // Also restarts the segment for receive times earlier than its start as the offsets are unsigned
+    segments_.push_back(Segment{records_.size(), timestamp});
+    records_.emplace_back(response, 0);
+    return;
+  }
+
+  void StateHistory::reserve(std::size_t const num_responses) {
+    records_.reserve(num_responses);
+    return;
+  }
+
+  void StateHistory::clear() noexcept {
+    records_.clear();
+    segments_.clear();
+    return;
+  }
+
+  std::size_t StateHistory::size() const noexcept {
+    return records_.size();
+  }
+
+  std::array<std::uint8_t,8> const& StateHistory::getData(std::size_t const index) const noexcept {
+    return records_[index].data;
+  }
+
+  std::chrono::steady_clock::time_point StateHistory::getTimestamp(std::size_t const index) const noexcept {
+    auto const it {std::upper_bound(segments_.begin(), segments_.end(), index,
+                                    [](std::size_t const i, Segment const& segment) { return i < segment.first; })};
+    auto const& segment {*std::prev(it)};
+    return segment.start + std::chrono::microseconds(records_[index].offset);
+  }
+
+  std::optional<Feedback> StateHistory::getFeedback(std::size_t const index) const noexcept {
+    auto const& data {records_[index].data};
+    if (!isFeedbackResponse(data[0])) {
+      return std::nullopt;
+    }
+    return GetMotorStatus2Response::decode(data.data());
+  }
+
+  std::optional<MotorStatus1> StateHistory::getMotorStatus1(std::size_t const index) const noexcept {
+    auto const& data {records_[index].data};
+    if (data[0] != GetMotorStatus1Response::command) {
+      return std::nullopt;
+    }
+    return GetMotorStatus1Response::decode(data.data());
+  }
+
+  std::optional<MotorStatus3> StateHistory::getMotorStatus3(std::size_t const index) const noexcept {
+    auto const& data {records_[index].data};
+    if (data[0] != GetMotorStatus3Response::command) {
+      return std::nullopt;
+    }
+    return GetMotorStatus3Response::decode(data.data());
+  }
+
+  std::vector<HistoryRecord> const& StateHistory::getRecords() const noexcept {
+    return records_;
+  }
+
+}
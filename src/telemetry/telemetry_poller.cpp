@@ -0,0 +1,141 @@
+#include "myactuator_rmd/telemetry/telemetry_poller.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ratio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/can/bus_timing.hpp"
+#include "myactuator_rmd/driver/request_priority.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+
+  TelemetryPoller::TelemetryPoller(ThreadSafeDriver& driver, std::vector<TelemetryRequest> const& requests,
+                                   CanBaudRate const baud_rate, float const max_utilisation)
+  : driver_{driver}, schedule_{}, max_utilisation_{max_utilisation},
+    cost_{2*can::getFrameDuration(baud_rate)}, budget_{}, max_budget_{}, last_refill_{}, num_polls_{0},
+    num_errors_{0}, num_throttled_{0}, mutex_{}, condition_variable_{}, is_running_{true}, thread_{} {
+    if ((max_utilisation <= 0.0f) || (max_utilisation > 1.0f)) {
+      throw ValueRangeException("Maximum bus utilisation '" + std::to_string(max_utilisation) + "' out of range ]0, 1]");
+    }
+    auto const start {Clock::now()};
+    for (auto const& request: requests) {
+      if (request.rate <= 0.0f) {
+        throw ValueRangeException("Polling rate '" + std::to_string(request.rate) + "' has to be positive");
+      }
+      // Only state reads have no arguments and do not alter the actuator
+      if (getRequestPriority(request.command) != RequestPriority::STATE) {
+        throw ValueRangeException("Command '" + std::to_string(static_cast<unsigned int>(request.command)) + "' is not a state read");
+      }
+      std::chrono::nanoseconds const period {static_cast<std::chrono::nanoseconds::rep>(std::nano::den/request.rate)};
+      schedule_.push_back(ScheduledRequest{request, period, start});
+    }
+    // Allow a burst of a single read per request
+    max_budget_ = cost_*static_cast<std::chrono::nanoseconds::rep>(std::max<std::size_t>(schedule_.size(), 1));
+    budget_ = max_budget_;
+    last_refill_ = start;
+    if (!schedule_.empty()) {
+      thread_ = std::thread(&TelemetryPoller::run, this);
+    }
+    return;
+  }
+
+  TelemetryPoller::~TelemetryPoller() {
+    {
+      std::lock_guard<std::mutex> const lock {mutex_};
+      is_running_ = false;
+    }
+    condition_variable_.notify_all();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    return;
+  }
+
+  float TelemetryPoller::getRequiredUtilisation() const noexcept {
+    float utilisation {0.0f};
+    for (auto const& scheduled: schedule_) {
+      utilisation += scheduled.request.rate*static_cast<float>(cost_.count())/static_cast<float>(std::nano::den);
+    }
+    return utilisation;
+  }
+
+  std::uint64_t TelemetryPoller::getNumPolls() const noexcept {
+    return num_polls_.load(std::memory_order_relaxed);
+  }
+
+  std::uint64_t TelemetryPoller::getNumErrors() const noexcept {
+    return num_errors_.load(std::memory_order_relaxed);
+  }
+
+  std::uint64_t TelemetryPoller::getNumThrottled() const noexcept {
+    return num_throttled_.load(std::memory_order_relaxed);
+  }
+
+  void TelemetryPoller::poll(TelemetryRequest const& request) noexcept {
+    try {
+      RawMessage const message {{static_cast<std::uint8_t>(request.command), 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+      // The response is published to the listeners of the driver from inside its bus thread
+      static_cast<void>(driver_.sendRecv(message, request.actuator_id));
+      num_polls_.fetch_add(1, std::memory_order_relaxed);
+    } catch (...) {
+      num_errors_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return;
+  }
+
+  void TelemetryPoller::refill(Clock::time_point const& now) noexcept {
+    auto const elapsed {std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_refill_)};
+    std::chrono::nanoseconds const earned {static_cast<std::chrono::nanoseconds::rep>(static_cast<float>(elapsed.count())*max_utilisation_)};
+    budget_ = std::min(budget_ + earned, max_budget_);
+    last_refill_ = now;
+    return;
+  }
+
+  void TelemetryPoller::run() noexcept {
+    std::unique_lock<std::mutex> lock {mutex_};
+    while (is_running_) {
+      auto scheduled {std::min_element(schedule_.begin(), schedule_.end(), [](auto const& a, auto const& b) {
+        return a.next_due < b.next_due;
+      })};
+      refill(Clock::now());
+      auto wake_up {scheduled->next_due};
+      bool const is_throttled {budget_ < cost_};
+      if (is_throttled) {
+        // Wait until enough bus time has become available
+        std::chrono::nanoseconds const missing {static_cast<std::chrono::nanoseconds::rep>(static_cast<float>((cost_ - budget_).count())/max_utilisation_)};
+        wake_up = std::max(wake_up, last_refill_ + missing);
+      }
+      if (condition_variable_.wait_until(lock, wake_up, [this]() { return !is_running_; })) {
+        break;
+      }
+      auto const now {Clock::now()};
+      refill(now);
+      if (budget_ < cost_) {
+        continue;
+      }
+      if (is_throttled && (scheduled->next_due < now)) {
+        num_throttled_.fetch_add(1, std::memory_order_relaxed);
+      }
+      budget_ -= cost_;
+      lock.unlock();
+      poll(scheduled->request);
+      lock.lock();
+      // Do not try to catch up with missed reads, this would only cause bursts
+      scheduled->next_due = std::max(scheduled->next_due + scheduled->period, now);
+    }
+    return;
+  }
+
+}
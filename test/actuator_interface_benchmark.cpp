@@ -0,0 +1,80 @@
+/**
+ * \file actuator_interface_benchmark.cpp
+ * \mainpage
+ *    Microbenchmark of the per-call overhead of the actuator interface without any bus communication
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/actuator_interface.hpp"
+
+
+namespace myactuator_rmd {
+  namespace benchmark {
+
+    /**\class LoopbackDriver
+     * \brief
+     *    In-process driver that answers every request immediately with the same feedback, this way only the
+     *    encoding, dispatching and decoding is measured
+    */
+    class LoopbackDriver final: public Driver {
+      public:
+        LoopbackDriver()
+        : response_{0x00, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00} {
+          return;
+        }
+        LoopbackDriver(LoopbackDriver const&) = delete;
+        LoopbackDriver& operator = (LoopbackDriver const&) = delete;
+        LoopbackDriver(LoopbackDriver&&) = delete;
+        LoopbackDriver& operator = (LoopbackDriver&&) = delete;
+
+        void addId(std::uint32_t const) override {
+          return;
+        }
+
+        void send(Message const&, std::uint32_t const) override {
+          return;
+        }
+
+        [[nodiscard]]
+        std::array<std::uint8_t,8> sendRecv(Message const& request, std::uint32_t const) override {
+          response_[0] = request.getData()[0];
+          return response_;
+        }
+
+      protected:
+        std::array<std::uint8_t,8> response_;
+    };
+
+  }
+}
+
+static void BM_ActuatorInterface(::benchmark::State& state) {
+  myactuator_rmd::benchmark::LoopbackDriver driver {};
+  myactuator_rmd::Driver& type_erased_driver {driver};
+  myactuator_rmd::ActuatorInterface actuator {type_erased_driver, 1};
+  for (auto _: state) {
+    ::benchmark::DoNotOptimize(actuator.sendVelocitySetpoint(500.0f));
+  }
+  return;
+}
+BENCHMARK(BM_ActuatorInterface);
+
+static void BM_BasicActuatorInterface(::benchmark::State& state) {
+  myactuator_rmd::benchmark::LoopbackDriver driver {};
+  myactuator_rmd::BasicActuatorInterface<myactuator_rmd::benchmark::LoopbackDriver> actuator {driver, 1};
+  for (auto _: state) {
+    ::benchmark::DoNotOptimize(actuator.sendVelocitySetpoint(500.0f));
+  }
+  return;
+}
+BENCHMARK(BM_BasicActuatorInterface);
+
+BENCHMARK_MAIN();
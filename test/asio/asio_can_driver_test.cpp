@@ -0,0 +1,176 @@
+/**
+ * \file asio_can_driver_test.cpp
+ * \mainpage
+ *    Tests for the Boost.Asio CAN driver communicating with a simulated actuator over a socket pair
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <system_error>
+#include <thread>
+
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/system/error_code.hpp>
+#include <gtest/gtest.h>
+#include <linux/can.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_2.hpp"
+#include "myactuator_rmd/asio/asio_can_driver.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    /**\class AsioCanDriverTest
+     * \brief
+     *    Test fixture connecting the driver to a simulated actuator over a socket pair preserving frame boundaries
+    */
+    class AsioCanDriverTest: public ::testing::Test {
+      protected:
+        void SetUp() override {
+          std::array<int,2> sockets {};
+          if (::socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets.data()) < 0) {
+            throw std::system_error(errno, std::generic_category(), "Could not create socket pair");
+          }
+          driver_.emplace(io_context_.get_executor(), sockets[0], std::chrono::milliseconds(20));
+          actuator_socket_ = sockets[1];
+          return;
+        }
+
+        void TearDown() override {
+          driver_.reset();
+          ::close(actuator_socket_);
+          return;
+        }
+
+        [[nodiscard]]
+        struct ::can_frame readRequest() const {
+          struct ::can_frame frame {};
+          EXPECT_EQ(::read(actuator_socket_, &frame, sizeof(struct ::can_frame)), sizeof(struct ::can_frame));
+          return frame;
+        }
+
+        void writeResponse(std::uint32_t const can_id, std::array<std::uint8_t,8> const& data) const {
+          struct ::can_frame frame {};
+          frame.can_id = can_id;
+          frame.len = 8;
+          std::copy(std::begin(data), std::end(data), std::begin(frame.data));
+          EXPECT_EQ(::write(actuator_socket_, &frame, sizeof(struct ::can_frame)), sizeof(struct ::can_frame));
+          return;
+        }
+
+        boost::asio::io_context io_context_ {};
+        std::optional<AsioCanDriver> driver_ {};
+        int actuator_socket_ {-1};
+    };
+
+    TEST_F(AsioCanDriverTest, sendWritesFrame) {
+      std::optional<boost::system::error_code> result {};
+      driver_->asyncSend(StopMotorRequest{}, 3, [&result](boost::system::error_code const& error) {
+        result = error;
+        return;
+      });
+      io_context_.run();
+      ASSERT_TRUE(result);
+      EXPECT_FALSE(*result);
+      auto const request {readRequest()};
+      EXPECT_EQ(request.can_id, 0x143);
+      EXPECT_EQ(request.data[0], 0x81);
+    }
+
+    TEST_F(AsioCanDriverTest, sendRecvSkipsForeignFrames) {
+      std::thread actuator {[this]() {
+        auto const request {readRequest()};
+        EXPECT_EQ(request.can_id, 0x141);
+        EXPECT_EQ(request.data[0], 0x9C);
+        // Reply of another actuator and a late reply to a different command precede the actual reply
+        writeResponse(0x242, {0x9C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+        writeResponse(0x241, {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00});
+        writeResponse(0x241, {0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00});
+        return;
+      }};
+      std::optional<MotorStatus2> motor_status {};
+      driver_->asyncSendRecv(GetMotorStatus2Request{}, 1,
+        [&motor_status](boost::system::error_code const& error, std::array<std::uint8_t,8> const& response) {
+          EXPECT_FALSE(error);
+          motor_status = GetMotorStatus2Response{response}.getStatus();
+          return;
+        });
+      io_context_.run();
+      actuator.join();
+      ASSERT_TRUE(motor_status);
+      EXPECT_EQ(motor_status->temperature, 50);
+      EXPECT_NEAR(motor_status->shaft_speed, 500.0f, 0.1f);
+    }
+
+    TEST_F(AsioCanDriverTest, callDecodesResult) {
+      std::thread actuator {[this]() {
+        auto const request {readRequest()};
+        EXPECT_EQ(request.can_id, 0x142);
+        EXPECT_EQ(request.data[0], 0xA1);
+        EXPECT_EQ(request.data[4], 0x64);
+        writeResponse(0x242, {0xA1, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00});
+        return;
+      }};
+      std::optional<Feedback> feedback {};
+      driver_->asyncCall<CommandType::TORQUE_CLOSED_LOOP_CONTROL>(2, 1.0f,
+        [&feedback](boost::system::error_code const& error, Feedback const& result) {
+          EXPECT_FALSE(error);
+          feedback = result;
+          return;
+        });
+      io_context_.run();
+      actuator.join();
+      ASSERT_TRUE(feedback);
+      EXPECT_EQ(feedback->temperature, 50);
+      EXPECT_NEAR(feedback->current, 1.0f, 0.01f);
+      EXPECT_NEAR(feedback->shaft_speed, 500.0f, 0.1f);
+    }
+
+    TEST_F(AsioCanDriverTest, sendRecvTimesOut) {
+      std::optional<boost::system::error_code> result {};
+      driver_->asyncSendRecv(GetMotorStatus2Request{}, 1,
+        [&result](boost::system::error_code const& error, std::array<std::uint8_t,8> const&) {
+          result = error;
+          return;
+        });
+      io_context_.run();
+      ASSERT_TRUE(result);
+      EXPECT_EQ(*result, boost::asio::error::timed_out);
+
+      // The driver can still be used after a timeout
+      std::thread actuator {[this]() {
+        static_cast<void>(readRequest());
+        static_cast<void>(readRequest());
+        writeResponse(0x241, {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00});
+        return;
+      }};
+      std::optional<float> angle {};
+      driver_->asyncSendRecv(GetMultiTurnAngleRequest{}, 1,
+        [&angle](boost::system::error_code const& error, std::array<std::uint8_t,8> const& response) {
+          EXPECT_FALSE(error);
+          angle = GetMultiTurnAngleResponse{response}.getAngle();
+          return;
+        });
+      io_context_.restart();
+      io_context_.run();
+      actuator.join();
+      ASSERT_TRUE(angle);
+      EXPECT_NEAR(*angle, 360.0f, 0.1f);
+    }
+
+  }
+}
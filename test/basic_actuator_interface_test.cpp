@@ -0,0 +1,83 @@
+/**
+ * \file basic_actuator_interface_test.cpp
+ * \mainpage
+ *    Test the statically dispatched actuator interface with drivers of different types
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/actuator_interface.hpp"
+#include "mock/driver_mock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    /**\class RecordingDriver
+     * \brief
+     *    Driver that does not derive from Driver and records the requests it was sent
+    */
+    class RecordingDriver {
+      public:
+        void addId(std::uint32_t const actuator_id) {
+          actuator_ids.push_back(actuator_id);
+          return;
+        }
+
+        void send(Message const& msg, std::uint32_t const) {
+          requests.push_back(msg.getData());
+          return;
+        }
+
+        [[nodiscard]]
+        std::array<std::uint8_t,8> sendRecv(Message const& request, std::uint32_t const) {
+          requests.push_back(request.getData());
+          return {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00};
+        }
+
+        std::vector<std::uint32_t> actuator_ids;
+        std::vector<std::array<std::uint8_t,8>> requests;
+    };
+
+    TEST(BasicActuatorInterfaceTest, driverWithoutVirtualInterface) {
+      RecordingDriver driver {};
+      myactuator_rmd::BasicActuatorInterface<RecordingDriver> actuator {driver, 3};
+      EXPECT_EQ(driver.actuator_ids, std::vector<std::uint32_t>{3});
+      EXPECT_NEAR(actuator.getMultiTurnAngle(), 360.0f, 0.1f);
+      actuator.reset();
+      ASSERT_EQ(driver.requests.size(), 2);
+      EXPECT_EQ(driver.requests[0][0], 0x92);
+      EXPECT_EQ(driver.requests[1][0], 0x76);
+    }
+
+    TEST(BasicActuatorInterfaceTest, concreteDriverType) {
+      ::testing::NiceMock<DriverMock> driver {};
+      EXPECT_CALL(driver, sendRecv(::testing::_, 1)).WillOnce(::testing::Return(
+        std::array<std::uint8_t,8>{0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}));
+      myactuator_rmd::BasicActuatorInterface<DriverMock> actuator {driver, 1};
+      EXPECT_NEAR(actuator.getMultiTurnAngle(), 360.0f, 0.1f);
+    }
+
+    TEST(BasicActuatorInterfaceTest, rawVelocitySetpoint) {
+      ::testing::NiceMock<DriverMock> driver {};
+      std::array<std::uint8_t,8> const request {0xA2, 0x00, 0x00, 0x00, 0x10, 0x27, 0x00, 0x00};
+      EXPECT_CALL(driver, sendRecv(::testing::Property(&Message::getData, request), 1)).WillOnce(::testing::Return(
+        std::array<std::uint8_t,8>{0xA2, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}));
+      myactuator_rmd::BasicActuatorInterface<DriverMock> actuator {driver, 1};
+      RawFeedback const feedback {actuator.sendVelocitySetpointRaw(10000)};
+      EXPECT_EQ(feedback.temperature, 50);
+      EXPECT_EQ(feedback.current, 100);
+      EXPECT_EQ(feedback.shaft_speed, 500);
+      EXPECT_EQ(feedback.shaft_angle, 45);
+    }
+
+  }
+}
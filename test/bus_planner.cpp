@@ -0,0 +1,168 @@
+/**
+ * \file bus_planner.cpp
+ * \mainpage
+ *    Command line tool predicting the bus utilisation and achievable loop rate of a control cycle
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/driver/bus_planner.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+/**\fn parseNumber
+ * \brief
+ *    Parse an unsigned number that has to make up the entire string
+ * 
+ * \param[in] str
+ *    The string containing the number
+ * \param[in] base
+ *    The base of the number, e.g. 16 for hexadecimal numbers with an optional '0x' prefix
+ * \return
+ *    The parsed number
+ * \throws std::invalid_argument if the string is not a valid number or out of range
+*/
+unsigned long parseNumber(std::string const& str, int const base) {
+  std::size_t num_parsed {0};
+  unsigned long number {0};
+  try {
+    number = std::stoul(str, &num_parsed, base);
+  } catch (std::logic_error const&) {
+    num_parsed = 0;
+  }
+  if (str.empty() || (num_parsed != str.size())) {
+    throw std::invalid_argument("'" + str + "' is not a valid number");
+  }
+  return number;
+}
+
+/**\fn parseRequests
+ * \brief
+ *    Parse a comma-separated list of commands with optional dividers sent to each actuator
+ * 
+ * \param[in] str
+ *    The list of requests, e.g. '0xA1,0x9A/100' for a torque set-point each cycle and status 1 every 100 cycles
+ * \param[in] num_actuators
+ *    The number of actuators with ids [1, num_actuators] the requests are sent to
+ * \return
+ *    The requests sent each cycle
+ * \throws std::invalid_argument or std::out_of_range if the list is malformed
+*/
+std::vector<myactuator_rmd::PlannedRequest> parseRequests(std::string const& str, std::uint32_t const num_actuators) {
+  std::vector<myactuator_rmd::PlannedRequest> requests {};
+  std::istringstream ss {str};
+  std::string token {};
+  while (std::getline(ss, token, ',')) {
+    auto const separator {token.find('/')};
+    auto const command {parseNumber(token.substr(0, separator), 16)};
+    if (command > 0xFF) {
+      throw std::out_of_range("Command '" + token.substr(0, separator) + "' does not fit into a single byte");
+    }
+    unsigned long divider {1};
+    if (separator != std::string::npos) {
+      divider = parseNumber(token.substr(separator + 1), 10);
+      if ((divider == 0) || (divider > std::numeric_limits<std::uint32_t>::max())) {
+        throw std::out_of_range("Divider '" + token.substr(separator + 1) + "' out of range");
+      }
+    }
+    for (std::uint32_t actuator_id = 1; actuator_id <= num_actuators; ++actuator_id) {
+      requests.emplace_back(actuator_id, static_cast<myactuator_rmd::CommandType>(command), static_cast<std::uint32_t>(divider));
+    }
+  }
+  return requests;
+}
+
+
+int main(int argc, char** argv) {
+  std::uint32_t bit_rate {};
+  std::uint32_t num_actuators {};
+  std::string requests {};
+  double turnaround {};
+  double host_overhead {};
+  double loop_rate {};
+
+  boost::program_options::options_description desc {"Allowed options"};
+  desc.add_options()
+    ("help", "Visualize help message")
+    ("bit_rate", boost::program_options::value(&bit_rate)->default_value(1000000), "Bit rate of the bus, either '500000' or '1000000'")
+    ("num_actuators", boost::program_options::value(&num_actuators)->required(), "Number of actuators on the bus, e.g. '10'")
+    ("requests", boost::program_options::value(&requests)->default_value("0xA1"), "Commands sent to each actuator with an optional divider, e.g. '0xA1,0x9A/100'")
+    ("turnaround", boost::program_options::value(&turnaround)->default_value(100.0), "Turnaround of the actuators in microseconds")
+    ("host_overhead", boost::program_options::value(&host_overhead)->default_value(20.0), "Overhead of the host per request in microseconds")
+    ("rate", boost::program_options::value(&loop_rate), "Desired loop rate in Hz, e.g. '1000'")
+  ;
+  boost::program_options::variables_map vm {};
+  try {
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    if (vm.count("help")) {
+      std::cout << desc << std::endl;
+      return EXIT_FAILURE;
+    }
+    boost::program_options::notify(vm);
+  } catch (boost::program_options::error const& e) {
+    std::cerr << "Invalid options: " << e.what() << "!" << std::endl;
+    std::cerr << desc << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  myactuator_rmd::CanBaudRate baud_rate {};
+  if (bit_rate == 1000000) {
+    baud_rate = myactuator_rmd::CanBaudRate::MBPS1;
+  } else if (bit_rate == 500000) {
+    baud_rate = myactuator_rmd::CanBaudRate::KBPS500;
+  } else {
+    std::cerr << "Unsupported bit rate '" << bit_rate << "'!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::chrono::duration<double,std::micro> const turnaround_us {turnaround};
+  std::chrono::duration<double,std::micro> const host_overhead_us {host_overhead};
+  myactuator_rmd::BusPlanner const planner {baud_rate, std::chrono::duration_cast<std::chrono::nanoseconds>(turnaround_us),
+                                            std::chrono::duration_cast<std::chrono::nanoseconds>(host_overhead_us)};
+  std::vector<myactuator_rmd::PlannedRequest> planned_requests {};
+  try {
+    planned_requests = parseRequests(requests, num_actuators);
+  } catch (std::logic_error const& e) {
+    std::cerr << "Malformed requests '" << requests << "': " << e.what() << "!" << std::endl;
+    std::cerr << desc << std::endl;
+    return EXIT_FAILURE;
+  }
+  myactuator_rmd::BusPlan plan {};
+  try {
+    plan = planner.plan(planned_requests);
+  } catch (myactuator_rmd::ValueRangeException const& e) {
+    std::cerr << "Invalid requests '" << requests << "': " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "Worst-case cycle time: " << plan.worst_case_cycle_time.count()/1000.0 << " us" << std::endl;
+  std::cout << "Average cycle time:    " << plan.average_cycle_time.count()/1000.0 << " us" << std::endl;
+  std::cout << "Maximum loop rate:     " << plan.max_loop_rate << " Hz" << std::endl;
+  std::cout << "Bus utilisation:       " << 100.0*plan.getUtilisation(plan.max_loop_rate) << " % at the maximum loop rate" << std::endl;
+  if (vm.count("rate")) {
+    std::cout << "Bus utilisation:       " << 100.0*plan.getUtilisation(loop_rate) << " % at " << loop_rate << " Hz" << std::endl;
+    if (!plan.isFeasible(loop_rate)) {
+      std::cout << "A loop rate of " << loop_rate << " Hz can not be achieved!" << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << "A loop rate of " << loop_rate << " Hz can be achieved." << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file bus_timing_test.cpp
+ * \mainpage
+ *    Tests for estimating the time CAN frames occupy the bus
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/can/bus_timing.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(BusTimingTest, frameBits) {
+      static_assert(myactuator_rmd::can::getFrameBits(8, false) == 111);
+      static_assert(myactuator_rmd::can::getFrameBits(8, true) == 135);
+      static_assert(myactuator_rmd::can::getFrameBits(0, false) == 47);
+      static_assert(myactuator_rmd::can::getFrameBits(0, true) == 55);
+    }
+
+    TEST(BusTimingTest, frameDuration) {
+      using namespace std::literals::chrono_literals;
+      EXPECT_EQ(myactuator_rmd::can::getFrameDuration(CanBaudRate::MBPS1), 135us);
+      EXPECT_EQ(myactuator_rmd::can::getFrameDuration(CanBaudRate::KBPS500), 270us);
+      EXPECT_EQ(myactuator_rmd::can::getFrameDuration(CanBaudRate::MBPS1, 8, false), 111us);
+    }
+
+  }
+}
@@ -0,0 +1,101 @@
+/**
+ * \file async_actuator_interface_test.cpp
+ * \mainpage
+ *    Tests for the awaitable actuator interface
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/coroutine/async_actuator_interface.hpp"
+#include "myactuator_rmd/coroutine/scheduler.hpp"
+#include "myactuator_rmd/coroutine/task.hpp"
+#include "myactuator_rmd/driver/request_priority.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+#include "../mock/driver_mock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    /**\fn reply
+     * \brief
+     *    Replies to status 2 requests and torque set-points with the temperature encoding the actuator id
+    */
+    std::array<std::uint8_t,8> reply(Message const& request, std::uint32_t const actuator_id) {
+      return std::array<std::uint8_t,8>{request.getData()[0], static_cast<std::uint8_t>(actuator_id), 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00};
+    }
+
+    /**\fn step
+     * \brief
+     *    Multi-step sequence reading the state, sending a set-point and checking its feedback
+    */
+    Task<void> step(AsyncActuatorInterface actuator, std::vector<int>& temperatures) {
+      auto const status {co_await actuator.getMotorStatus2Async()};
+      auto const feedback {co_await actuator.sendCurrentSetpointAsync(static_cast<float>(status.temperature)/100.0f)};
+      temperatures.push_back(feedback.temperature);
+      co_return;
+    }
+
+    TEST(AsyncActuatorInterfaceTest, sequencesRunConcurrentlyOnOneThread) {
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([&](Message const& request, std::uint32_t const actuator_id) {
+        // Replies are only delayed in order to let other sequences enqueue their requests in the meantime
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        return reply(request, actuator_id);
+      });
+      myactuator_rmd::ThreadSafeDriver driver {driver_mock};
+      myactuator_rmd::Scheduler scheduler {};
+      std::vector<int> temperatures {};
+      std::vector<AsyncActuatorInterface> actuators {};
+      for (std::uint32_t i = 1; i <= 4; ++i) {
+        actuators.emplace_back(driver, scheduler, i);
+        scheduler.spawn(step(actuators.back(), temperatures));
+      }
+      EXPECT_CALL(driver_mock, sendRecv).Times(8);
+      scheduler.run();
+      std::sort(temperatures.begin(), temperatures.end());
+      EXPECT_EQ(temperatures, (std::vector<int>{1, 2, 3, 4}));
+      // The reads of all sequences were waiting on the bus at the same time instead of one after another
+      EXPECT_GE(driver.getStatistics(RequestPriority::STATE).max_waiting_time, std::chrono::milliseconds(10));
+    }
+
+    TEST(AsyncActuatorInterfaceTest, exceptionsArePropagated) {
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      myactuator_rmd::ThreadSafeDriver driver {driver_mock};
+      myactuator_rmd::Scheduler scheduler {};
+      AsyncActuatorInterface actuator {driver, scheduler, 1};
+      EXPECT_CALL(driver_mock, sendRecv).WillOnce(::testing::Throw(myactuator_rmd::Exception("Timeout")));
+      bool is_caught {false};
+      scheduler.spawn([](AsyncActuatorInterface actuator, bool& is_caught) -> Task<void> {
+        try {
+          static_cast<void>(co_await actuator.getMultiTurnAngleAsync());
+        } catch (myactuator_rmd::Exception const&) {
+          is_caught = true;
+        }
+        co_return;
+      }(actuator, is_caught));
+      scheduler.run();
+      EXPECT_TRUE(is_caught);
+
+      EXPECT_CALL(driver_mock, sendRecv).WillOnce(::testing::Throw(myactuator_rmd::Exception("Timeout")));
+      scheduler.spawn([](AsyncActuatorInterface actuator) -> Task<void> {
+        co_await actuator.stopMotorAsync();
+      }(actuator));
+      EXPECT_THROW(scheduler.run(), myactuator_rmd::Exception);
+    }
+
+  }
+}
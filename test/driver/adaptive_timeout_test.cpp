@@ -0,0 +1,76 @@
+/**
+ * \file adaptive_timeout_test.cpp
+ * \mainpage
+ *    Tests for deriving receive timeouts from the observed round-trip times
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <chrono>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/driver/adaptive_timeout.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(AdaptiveTimeoutTest, ceilingUntilEnoughSamples) {
+      using namespace std::literals::chrono_literals;
+      myactuator_rmd::AdaptiveTimeout adaptive_timeout {3.0, 100us, 100ms, 0.999, 100, 1000};
+      EXPECT_EQ(adaptive_timeout.getTimeout(1, 0x9C), 100ms);
+      EXPECT_FALSE(adaptive_timeout.getRoundTripTime(1, 0x9C));
+      for (int i = 0; i < 99; ++i) {
+        adaptive_timeout.addRoundTrip(1, 0x9C, 400us);
+      }
+      EXPECT_EQ(adaptive_timeout.getTimeout(1, 0x9C), 100ms);
+      for (int i = 0; i < 16; ++i) {
+        adaptive_timeout.addRoundTrip(1, 0x9C, 400us);
+      }
+      EXPECT_NEAR(adaptive_timeout.getTimeout(1, 0x9C).count(), 1200, 12);
+      EXPECT_NEAR(adaptive_timeout.getRoundTripTime(1, 0x9C)->count(), 400000, 4000);
+      // Other actuators and commands are tracked separately
+      EXPECT_EQ(adaptive_timeout.getTimeout(2, 0x9C), 100ms);
+      EXPECT_EQ(adaptive_timeout.getTimeout(1, 0x92), 100ms);
+    }
+
+    TEST(AdaptiveTimeoutTest, clampedToFloorAndCeiling) {
+      using namespace std::literals::chrono_literals;
+      myactuator_rmd::AdaptiveTimeout adaptive_timeout {3.0, 500us, 10ms, 0.999, 10, 100};
+      for (int i = 0; i < 20; ++i) {
+        adaptive_timeout.addRoundTrip(1, 0x9C, 10us);
+        adaptive_timeout.addRoundTrip(2, 0x9C, 50ms);
+      }
+      EXPECT_EQ(adaptive_timeout.getTimeout(1, 0x9C), 500us);
+      EXPECT_EQ(adaptive_timeout.getTimeout(2, 0x9C), 10ms);
+    }
+
+    TEST(AdaptiveTimeoutTest, timeoutsWidenTimeout) {
+      using namespace std::literals::chrono_literals;
+      myactuator_rmd::AdaptiveTimeout adaptive_timeout {2.0, 100us, 1s, 0.99, 100, 1000};
+      for (int i = 0; i < 112; ++i) {
+        adaptive_timeout.addRoundTrip(1, 0x9C, 1ms);
+      }
+      auto const initial_timeout {adaptive_timeout.getTimeout(1, 0x9C)};
+      EXPECT_NEAR(initial_timeout.count(), 2000, 20);
+      auto previous_timeout {initial_timeout};
+      for (int i = 0; i < 5; ++i) {
+        adaptive_timeout.addTimeout(1, 0x9C);
+        EXPECT_GE(adaptive_timeout.getTimeout(1, 0x9C), previous_timeout);
+        previous_timeout = adaptive_timeout.getTimeout(1, 0x9C);
+      }
+      EXPECT_GT(previous_timeout, initial_timeout);
+    }
+
+    TEST(AdaptiveTimeoutTest, invalidArguments) {
+      using namespace std::literals::chrono_literals;
+      EXPECT_THROW(myactuator_rmd::AdaptiveTimeout(0.5), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::AdaptiveTimeout(3.0, 10ms, 1ms), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::AdaptiveTimeout(3.0, 1ms, 10ms, 1.5), myactuator_rmd::ValueRangeException);
+    }
+
+  }
+}
@@ -0,0 +1,82 @@
+/**
+ * \file bus_planner_test.cpp
+ * \mainpage
+ *    Tests for predicting the bus utilisation and achievable loop rate
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/driver/bus_planner.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(BusPlannerTest, roundTripTime) {
+      using namespace std::literals::chrono_literals;
+      myactuator_rmd::BusPlanner planner {CanBaudRate::MBPS1, 100us, 20us};
+      EXPECT_EQ(planner.getRoundTripTime(CommandType::TORQUE_CLOSED_LOOP_CONTROL), 390us);
+      planner.setTurnaround(CommandType::READ_MOTOR_STATUS_3, 300us);
+      EXPECT_EQ(planner.getRoundTripTime(CommandType::READ_MOTOR_STATUS_3), 590us);
+      myactuator_rmd::BusPlanner const slow_planner {CanBaudRate::KBPS500, 100us, 20us};
+      EXPECT_EQ(slow_planner.getRoundTripTime(CommandType::TORQUE_CLOSED_LOOP_CONTROL), 660us);
+    }
+
+    TEST(BusPlannerTest, tenActuatorsOnOneBus) {
+      using namespace std::literals::chrono_literals;
+      myactuator_rmd::BusPlanner const planner {CanBaudRate::MBPS1, 100us, 20us};
+      std::vector<myactuator_rmd::PlannedRequest> requests {};
+      for (std::uint32_t i = 1; i <= 10; ++i) {
+        requests.emplace_back(i, CommandType::TORQUE_CLOSED_LOOP_CONTROL);
+        requests.emplace_back(i, CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG, 10);
+      }
+      auto const plan {planner.plan(requests)};
+      EXPECT_EQ(plan.worst_case_cycle_time, 10*2*390us);
+      EXPECT_EQ(plan.average_cycle_time, 10*390us + 390us);
+      EXPECT_EQ(plan.worst_case_bus_time, 10*2*270us);
+      EXPECT_EQ(plan.average_bus_time, 10*270us + 270us);
+      EXPECT_NEAR(plan.max_loop_rate, 1.0e6/7800.0, 1.0e-6);
+      EXPECT_NEAR(plan.getUtilisation(100.0), 0.297, 1.0e-6);
+      EXPECT_TRUE(plan.isFeasible(100.0));
+      EXPECT_FALSE(plan.isFeasible(1000.0));
+    }
+
+    TEST(BusPlannerTest, emptyCycle) {
+      myactuator_rmd::BusPlanner const planner {};
+      auto const plan {planner.plan({})};
+      EXPECT_EQ(plan.worst_case_cycle_time.count(), 0);
+      EXPECT_TRUE(plan.isFeasible(10000.0));
+    }
+
+    TEST(BusPlannerTest, invalidDivider) {
+      myactuator_rmd::BusPlanner const planner {};
+      EXPECT_THROW(static_cast<void>(planner.plan({PlannedRequest{1, CommandType::STOP_MOTOR, 0}})), myactuator_rmd::ValueRangeException);
+    }
+
+    TEST(BusPlannerTest, invalidActuatorId) {
+      myactuator_rmd::BusPlanner const planner {};
+      EXPECT_THROW(static_cast<void>(planner.plan({PlannedRequest{0, CommandType::STOP_MOTOR}})), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(static_cast<void>(planner.plan({PlannedRequest{33, CommandType::STOP_MOTOR}})), myactuator_rmd::ValueRangeException);
+    }
+
+    TEST(BusPlannerTest, duplicateSetpoints) {
+      myactuator_rmd::BusPlanner const planner {};
+      EXPECT_THROW(static_cast<void>(planner.plan({PlannedRequest{1, CommandType::TORQUE_CLOSED_LOOP_CONTROL},
+                                                   PlannedRequest{1, CommandType::SPEED_CLOSED_LOOP_CONTROL, 10}})),
+                   myactuator_rmd::ValueRangeException);
+      EXPECT_NO_THROW(static_cast<void>(planner.plan({PlannedRequest{1, CommandType::TORQUE_CLOSED_LOOP_CONTROL},
+                                                      PlannedRequest{2, CommandType::TORQUE_CLOSED_LOOP_CONTROL},
+                                                      PlannedRequest{1, CommandType::READ_MOTOR_STATUS_2}})));
+    }
+
+  }
+}
@@ -0,0 +1,145 @@
+/**
+ * \file coalescing_driver_test.cpp
+ * \mainpage
+ *    Tests for merging identical read requests
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/driver/coalescing_driver.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/actuator_interface.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+#include "../mock/driver_mock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(CoalescingDriverTest, mergesReadsInFlight) {
+      using namespace std::literals::chrono_literals;
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      std::atomic<int> num_bus_requests {0};
+      constexpr int num_threads {4};
+      myactuator_rmd::ThreadSafeDriver thread_safe_driver {driver_mock};
+      myactuator_rmd::CoalescingDriver driver {thread_safe_driver};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([&](Message const&, std::uint32_t const) {
+        ++num_bus_requests;
+        // Keep the read in flight until all other threads have joined it
+        auto const timeout {std::chrono::steady_clock::now() + 2s};
+        while ((driver.getNumCoalesced() < num_threads - 1) && (std::chrono::steady_clock::now() < timeout)) {
+          std::this_thread::sleep_for(1ms);
+        }
+        return std::array<std::uint8_t,8>{0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00};
+      });
+      std::vector<myactuator_rmd::ActuatorInterface> actuators (num_threads, myactuator_rmd::ActuatorInterface{driver, 1});
+      std::vector<std::thread> threads {};
+      std::atomic<int> num_correct {0};
+      for (auto& actuator: actuators) {
+        threads.emplace_back([&actuator, &num_correct]() {
+          auto const status {actuator.getMotorStatus2()};
+          if (status.temperature == 50) {
+            ++num_correct;
+          }
+        });
+      }
+      for (auto& thread: threads) {
+        thread.join();
+      }
+      EXPECT_EQ(num_correct, num_threads);
+      EXPECT_EQ(num_bus_requests, 1);
+      EXPECT_EQ(driver.getNumForwarded(), 1);
+      EXPECT_EQ(driver.getNumCoalesced(), num_threads - 1);
+    }
+
+    TEST(CoalescingDriverTest, answersFromFreshnessWindow) {
+      using namespace std::literals::chrono_literals;
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([](Message const& request, std::uint32_t const) {
+        return request.getData();
+      });
+      myactuator_rmd::CoalescingDriver driver {driver_mock, 100ms};
+      EXPECT_CALL(driver_mock, sendRecv).Times(3);
+      static_cast<void>(driver.sendRecv(GetMultiTurnAngleRequest{}, 1));
+      static_cast<void>(driver.sendRecv(GetMultiTurnAngleRequest{}, 1));
+      // Different actuators and requests are not merged
+      static_cast<void>(driver.sendRecv(GetMultiTurnAngleRequest{}, 2));
+      static_cast<void>(driver.sendRecv(GetMotorStatus1Request{}, 1));
+      EXPECT_EQ(driver.getNumCached(), 1);
+      ::testing::Mock::VerifyAndClearExpectations(&driver_mock);
+
+      // Set-points always go to the bus and invalidate the cached responses of the actuator
+      EXPECT_CALL(driver_mock, sendRecv).Times(3);
+      static_cast<void>(driver.sendRecv(SetTorqueRequest{1.0f}, 1));
+      static_cast<void>(driver.sendRecv(SetTorqueRequest{1.0f}, 1));
+      static_cast<void>(driver.sendRecv(GetMultiTurnAngleRequest{}, 1));
+      static_cast<void>(driver.sendRecv(GetMultiTurnAngleRequest{}, 2));
+      EXPECT_EQ(driver.getNumCached(), 2);
+    }
+
+    TEST(CoalescingDriverTest, doesNotJoinReadsIssuedBeforeWrite) {
+      using namespace std::literals::chrono_literals;
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      myactuator_rmd::CoalescingDriver driver {driver_mock, 1s};
+      std::atomic<int> num_reads {0};
+      std::atomic<bool> is_read_in_flight {false};
+      std::atomic<bool> is_write_done {false};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([&](Message const& request, std::uint32_t const) {
+        if (request.getData()[0] != 0x92) {
+          return request.getData();
+        }
+        // The first read is kept in flight until the write was performed and returns the stale angle
+        if (num_reads.fetch_add(1) == 0) {
+          is_read_in_flight = true;
+          auto const timeout {std::chrono::steady_clock::now() + 2s};
+          while (!is_write_done && (std::chrono::steady_clock::now() < timeout)) {
+            std::this_thread::sleep_for(1ms);
+          }
+          return std::array<std::uint8_t,8>{0x92, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00};
+        }
+        return std::array<std::uint8_t,8>{0x92, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00};
+      });
+      std::array<std::uint8_t,8> stale_response {};
+      std::thread slow_reader {[&driver, &stale_response]() {
+        stale_response = driver.sendRecv(GetMultiTurnAngleRequest{}, 1);
+      }};
+      auto const timeout {std::chrono::steady_clock::now() + 2s};
+      while (!is_read_in_flight && (std::chrono::steady_clock::now() < timeout)) {
+        std::this_thread::sleep_for(1ms);
+      }
+      static_cast<void>(driver.sendRecv(SetTorqueRequest{1.0f}, 1));
+      auto const response {driver.sendRecv(GetMultiTurnAngleRequest{}, 1)};
+      is_write_done = true;
+      slow_reader.join();
+      EXPECT_EQ(stale_response[4], 0x01);
+      EXPECT_EQ(response[4], 0x02);
+      EXPECT_EQ(driver.getNumCoalesced(), 0);
+      // The stale read must not be cached once it completes either
+      EXPECT_EQ(driver.sendRecv(GetMultiTurnAngleRequest{}, 1)[4], 0x02);
+      EXPECT_EQ(num_reads, 2);
+    }
+
+    TEST(CoalescingDriverTest, doesNotCacheErrors) {
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      myactuator_rmd::CoalescingDriver driver {driver_mock, std::chrono::seconds(1)};
+      EXPECT_CALL(driver_mock, sendRecv)
+        .WillOnce(::testing::Throw(myactuator_rmd::ProtocolException("Unexpected response")))
+        .WillOnce(::testing::Return(std::array<std::uint8_t,8>{0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}));
+      EXPECT_THROW(static_cast<void>(driver.sendRecv(GetMultiTurnAngleRequest{}, 1)), myactuator_rmd::ProtocolException);
+      EXPECT_NO_THROW(static_cast<void>(driver.sendRecv(GetMultiTurnAngleRequest{}, 1)));
+    }
+
+  }
+}
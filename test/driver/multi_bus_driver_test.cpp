@@ -0,0 +1,91 @@
+/**
+ * \file multi_bus_driver_test.cpp
+ * \mainpage
+ *    Tests for operating several buses in parallel
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/driver/multi_bus_driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/actuator_interface.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+#include "../mock/driver_mock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(MultiBusDriverTest, addressesActuatorsByBus) {
+      ::testing::NiceMock<DriverMock> bus_0 {};
+      ::testing::NiceMock<DriverMock> bus_1 {};
+      myactuator_rmd::MultiBusDriver driver {{bus_0, bus_1}, {0, 0}};
+      EXPECT_EQ(driver.getNumBuses(), 2);
+      EXPECT_CALL(bus_0, addId(1)).Times(1);
+      EXPECT_CALL(bus_1, addId(1)).Times(1);
+      EXPECT_CALL(bus_1, sendRecv(::testing::_, 1)).WillOnce(::testing::Return(
+        std::array<std::uint8_t,8>{0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}));
+      driver.addId({0, 1});
+      myactuator_rmd::ActuatorInterface actuator {driver.getBus(1), 1};
+      EXPECT_NEAR(actuator.getMultiTurnAngle(), 360.0f, 0.1f);
+      EXPECT_THROW(static_cast<void>(driver.getBus(2)), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(driver.send(StopMotorRequest{}, {2, 1}), myactuator_rmd::ValueRangeException);
+    }
+
+    TEST(MultiBusDriverTest, cycleIsIssuedOnAllBusesInParallel) {
+      using namespace std::literals::chrono_literals;
+      constexpr std::size_t num_buses {4};
+      std::array<::testing::NiceMock<DriverMock>,num_buses> mocks {};
+      std::vector<std::reference_wrapper<Driver>> drivers {};
+      for (std::size_t i = 0; i < num_buses; ++i) {
+        ON_CALL(mocks[i], sendRecv).WillByDefault([i](Message const&, std::uint32_t const actuator_id) {
+          std::this_thread::sleep_for(50ms);
+          return std::array<std::uint8_t,8>{0xA1, static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(actuator_id), 0, 0, 0, 0, 0};
+        });
+        drivers.emplace_back(mocks[i]);
+      }
+      myactuator_rmd::MultiBusDriver driver {drivers};
+
+      std::vector<myactuator_rmd::AddressedMessage> requests {};
+      for (std::size_t i = 0; i < num_buses; ++i) {
+        requests.emplace_back(BusAddress{i, 1}, SetTorqueRequest{0.0f});
+      }
+      requests.emplace_back(BusAddress{0, 2}, SetTorqueRequest{0.0f});
+      auto const start {std::chrono::steady_clock::now()};
+      auto const responses {driver.sendRecv(requests)};
+      auto const duration {std::chrono::steady_clock::now() - start};
+      // Two requests on the first bus take longer than one request on each other bus
+      EXPECT_GE(duration, 100ms);
+      EXPECT_LT(duration, 200ms);
+      ASSERT_EQ(responses.size(), requests.size());
+      for (std::size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(responses[i][1], requests[i].address.bus);
+        EXPECT_EQ(responses[i][2], requests[i].address.actuator_id);
+      }
+    }
+
+    TEST(MultiBusDriverTest, cycleWaitsForAllRequestsBeforeThrowing) {
+      ::testing::NiceMock<DriverMock> bus_0 {};
+      ::testing::NiceMock<DriverMock> bus_1 {};
+      myactuator_rmd::MultiBusDriver driver {{bus_0, bus_1}};
+      EXPECT_CALL(bus_0, sendRecv).WillOnce(::testing::Throw(myactuator_rmd::Exception("Timeout")));
+      EXPECT_CALL(bus_1, sendRecv).Times(2);
+      std::vector<myactuator_rmd::AddressedMessage> const requests {{BusAddress{0, 1}, SetTorqueRequest{0.0f}},
+        {BusAddress{1, 1}, SetTorqueRequest{0.0f}}, {BusAddress{1, 2}, SetTorqueRequest{0.0f}}};
+      EXPECT_THROW(static_cast<void>(driver.sendRecv(requests)), myactuator_rmd::Exception);
+    }
+
+  }
+}
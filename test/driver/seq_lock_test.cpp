@@ -0,0 +1,84 @@
+/**
+ * \file seq_lock_test.cpp
+ * \mainpage
+ *    Tests for the sequence lock publishing values to concurrent readers
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/driver/seq_lock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(SeqLockTest, versions) {
+      myactuator_rmd::SeqLock<double> lock {};
+      EXPECT_FALSE(lock.load());
+      EXPECT_EQ(lock.getVersion(), 0);
+      lock.store(1.5);
+      lock.store(2.5);
+      ASSERT_TRUE(lock.load());
+      EXPECT_EQ(*lock.load(), 2.5);
+      EXPECT_EQ(lock.getVersion(), 2);
+      EXPECT_TRUE(lock.load(2));
+      EXPECT_FALSE(lock.load(1));
+      lock.store(3.5, 7);
+      EXPECT_EQ(lock.getVersion(), 7);
+      ASSERT_TRUE(lock.load(7));
+      EXPECT_EQ(*lock.load(7), 3.5);
+      EXPECT_FALSE(lock.load(0));
+    }
+
+    TEST(SeqLockTest, loadOwned) {
+      myactuator_rmd::SeqLock<double> lock {};
+      EXPECT_FALSE(lock.loadOwned());
+      lock.store(1.5);
+      ASSERT_TRUE(lock.loadOwned());
+      EXPECT_EQ(*lock.loadOwned(), 1.5);
+    }
+
+    TEST(SeqLockTest, alignment) {
+      EXPECT_EQ(alignof(myactuator_rmd::SeqLock<double>), 64);
+      EXPECT_EQ(sizeof(myactuator_rmd::SeqLock<double>), 64);
+      // Packed locks only hold the sequence and the words of the value
+      using PackedLock = myactuator_rmd::SeqLock<std::array<std::uint64_t,2>,alignof(std::uint64_t)>;
+      EXPECT_EQ(sizeof(PackedLock), 3*sizeof(std::uint64_t));
+    }
+
+    TEST(SeqLockTest, consistentConcurrentReads) {
+      // Larger than a single word so that torn reads can be detected
+      myactuator_rmd::SeqLock<std::array<std::uint32_t,5>> lock {};
+      std::atomic<bool> is_running {true};
+      std::atomic<bool> has_written {false};
+      std::thread writer {[&lock, &is_running, &has_written]() {
+        for (std::uint32_t i = 0; is_running.load(); ++i) {
+          lock.store({i, i, i, i, i});
+          has_written.store(true);
+        }
+        return;
+      }};
+      while (!has_written.load()) {
+        std::this_thread::yield();
+      }
+      for (int i = 0; i < 100000; ++i) {
+        auto const value {lock.load()};
+        ASSERT_TRUE(value);
+        for (std::size_t j = 1; j < value->size(); ++j) {
+          ASSERT_EQ((*value)[j], (*value)[0]);
+        }
+      }
+      is_running.store(false);
+      writer.join();
+    }
+
+  }
+}
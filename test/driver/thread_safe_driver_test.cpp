@@ -0,0 +1,157 @@
+/**
+ * \file thread_safe_driver_test.cpp
+ * \mainpage
+ *    Tests for sharing a single driver between several threads
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/driver/request_priority.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/actuator_interface.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+#include "../mock/driver_mock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(ThreadSafeDriverTest, forwardsRequests) {
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      EXPECT_CALL(driver_mock, addId(1)).Times(1);
+      EXPECT_CALL(driver_mock, sendRecv).WillOnce(::testing::Return(std::array<std::uint8_t,8>{0xB2, 0x00, 0x00, 0x00, 0x2E, 0x89, 0x34, 0x01}));
+      myactuator_rmd::ThreadSafeDriver driver {driver_mock};
+      myactuator_rmd::ActuatorInterface actuator {driver, 1};
+      EXPECT_EQ(actuator.getVersionDate(), 20220206);
+    }
+
+    TEST(ThreadSafeDriverTest, serialisesConcurrentCallers) {
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      std::atomic<int> num_active {0};
+      std::atomic<int> max_active {0};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([&](Message const& request, std::uint32_t const actuator_id) {
+        auto const active {++num_active};
+        if (active > max_active) {
+          max_active = active;
+        }
+        auto response {request.getData()};
+        response[7] = static_cast<std::uint8_t>(actuator_id);
+        --num_active;
+        return response;
+      });
+      myactuator_rmd::ThreadSafeDriver driver {driver_mock};
+
+      constexpr int num_threads {4};
+      constexpr int num_requests {500};
+      std::atomic<int> num_mismatches {0};
+      std::vector<std::thread> threads {};
+      for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&driver, &num_mismatches, t]() {
+          auto const actuator_id {static_cast<std::uint32_t>(t + 1)};
+          for (int i = 0; i < num_requests; ++i) {
+            myactuator_rmd::RawMessage const request {{0x9C, static_cast<std::uint8_t>(i), 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+            auto const response {driver.sendRecv(request, actuator_id)};
+            if ((response[1] != static_cast<std::uint8_t>(i)) || (response[7] != actuator_id)) {
+              ++num_mismatches;
+            }
+          }
+        });
+      }
+      for (auto& thread: threads) {
+        thread.join();
+      }
+      EXPECT_EQ(num_mismatches, 0);
+      EXPECT_EQ(max_active, 1);
+    }
+
+    TEST(ThreadSafeDriverTest, propagatesExceptions) {
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      EXPECT_CALL(driver_mock, sendRecv).WillOnce(::testing::Throw(myactuator_rmd::ProtocolException("Unexpected response")));
+      myactuator_rmd::ThreadSafeDriver driver {driver_mock};
+      myactuator_rmd::RawMessage const request {{0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
+      EXPECT_THROW(static_cast<void>(driver.sendRecv(request, 1)), myactuator_rmd::ProtocolException);
+    }
+
+    TEST(ThreadSafeDriverTest, realTimeRequestsOvertakeDiagnostics) {
+      using namespace std::literals::chrono_literals;
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      std::promise<void> release_bus {};
+      auto const is_bus_released {release_bus.get_future().share()};
+      std::mutex mutex {};
+      std::vector<std::uint8_t> order {};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([&](Message const& request, std::uint32_t const) {
+        auto const command {request.getData()[0]};
+        if (command == CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG) {
+          is_bus_released.wait();
+        }
+        std::lock_guard<std::mutex> const lock {mutex};
+        order.push_back(command);
+        return request.getData();
+      });
+      myactuator_rmd::ThreadSafeDriver driver {driver_mock};
+
+      // Block the bus with a state request while a diagnostics and a set-point request are enqueued
+      std::thread blocking_thread {[&driver]() {
+        static_cast<void>(driver.sendRecv(GetMotorStatus1Request{}, 1));
+      }};
+      std::this_thread::sleep_for(20ms);
+      std::thread diagnostics_thread {[&driver]() {
+        static_cast<void>(driver.sendRecv(GetMotorModelRequest{}, 1));
+      }};
+      std::this_thread::sleep_for(20ms);
+      std::thread control_thread {[&driver]() {
+        static_cast<void>(driver.sendRecv(SetTorqueRequest{1.0f}, 1));
+      }};
+      std::this_thread::sleep_for(20ms);
+      release_bus.set_value();
+      blocking_thread.join();
+      diagnostics_thread.join();
+      control_thread.join();
+
+      std::vector<std::uint8_t> const expected_order {
+        static_cast<std::uint8_t>(CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG),
+        static_cast<std::uint8_t>(CommandType::TORQUE_CLOSED_LOOP_CONTROL),
+        static_cast<std::uint8_t>(CommandType::READ_MOTOR_MODEL)
+      };
+      EXPECT_EQ(order, expected_order);
+      auto const diagnostics_statistics {driver.getStatistics(RequestPriority::CONFIGURATION)};
+      EXPECT_EQ(diagnostics_statistics.num_requests, 1);
+      EXPECT_EQ(diagnostics_statistics.num_preemptions, 1);
+      EXPECT_GE(diagnostics_statistics.max_waiting_time, 20ms);
+      EXPECT_EQ(driver.getStatistics(RequestPriority::REAL_TIME).num_requests, 1);
+      EXPECT_EQ(driver.getStatistics(RequestPriority::STATE).num_requests, 1);
+    }
+
+    TEST(ThreadSafeDriverTest, diagnosticsOnlyUseLeftOverBusTime) {
+      using namespace std::literals::chrono_literals;
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([](Message const& request, std::uint32_t const) {
+        std::this_thread::sleep_for(6ms);
+        return request.getData();
+      });
+      myactuator_rmd::ThreadSafeDriver driver {driver_mock, 10ms};
+      constexpr int num_requests {5};
+      for (int i = 0; i < num_requests; ++i) {
+        static_cast<void>(driver.sendRecv(GetControllerGainsRequest{}, 1));
+      }
+      auto const statistics {driver.getStatistics(RequestPriority::CONFIGURATION)};
+      EXPECT_EQ(statistics.num_requests, num_requests);
+      EXPECT_GE(statistics.num_deferrals, 1);
+    }
+
+  }
+}
@@ -0,0 +1,80 @@
+/**
+ * \file state_estimator_test.cpp
+ * \mainpage
+ *    Tests for the estimator of the position and velocity in between received samples
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/estimation/state_estimator.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(StateEstimatorTest, invalidGains) {
+      EXPECT_THROW(myactuator_rmd::StateEstimator(0.0), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::StateEstimator(0.5, 2.0), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::StateEstimator(0.5, 0.1, 1.5), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::StateEstimator(0.5, 0.1, 0.5, std::chrono::milliseconds(-1)), myactuator_rmd::ValueRangeException);
+    }
+
+    TEST(StateEstimatorTest, noSamples) {
+      myactuator_rmd::StateEstimator estimator {};
+      estimator.onResponse(1, {0xB2, 0x00, 0x00, 0x00, 0x2E, 0x89, 0x34, 0x01}, std::chrono::steady_clock::time_point{});
+      EXPECT_FALSE(estimator.getState(1));
+      EXPECT_FALSE(estimator.getState(0));
+    }
+
+    TEST(StateEstimatorTest, extrapolatesFeedback) {
+      myactuator_rmd::StateEstimator estimator {};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      // Shaft angle of 45 degree and speed of 500 degree per second
+      estimator.onResponse(1, {0xA2, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, start);
+      auto const state {estimator.getState(1, start + std::chrono::milliseconds(10))};
+      ASSERT_TRUE(state);
+      EXPECT_NEAR(state->position, 50.0, 1.0e-6);
+      EXPECT_NEAR(state->velocity, 500.0, 1.0e-6);
+      EXPECT_EQ(state->age, std::chrono::milliseconds(10));
+    }
+
+    TEST(StateEstimatorTest, limitsVelocityStepOfCloseSamples) {
+      myactuator_rmd::StateEstimator estimator {0.5, 0.1, 0.0, std::chrono::milliseconds(10)};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      // The shaft angle of the feedback has a resolution of 1 degree, a single step 1 millisecond later
+      estimator.onResponse(1, {0xA2, 0x32, 0x64, 0x00, 0x00, 0x00, 0x2D, 0x00}, start);
+      estimator.onResponse(1, {0xA2, 0x32, 0x64, 0x00, 0x00, 0x00, 0x2E, 0x00}, start + std::chrono::milliseconds(1));
+      auto const state {estimator.getState(1, start + std::chrono::milliseconds(1))};
+      ASSERT_TRUE(state);
+      EXPECT_NEAR(state->velocity, 0.1*1.0/0.01, 1.0e-6);
+    }
+
+    TEST(StateEstimatorTest, tracksConstantVelocity) {
+      myactuator_rmd::StateEstimator estimator {0.5, 0.1, 0.0};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      constexpr double velocity {100.0};
+      for (int i = 0; i < 200; ++i) {
+        // Multi-turn angle readings with a resolution of 0.01 degree every 10 milliseconds
+        auto const angle {static_cast<std::int64_t>(velocity*i*0.01*100.0)};
+        std::array<std::uint8_t,8> response {0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+        for (std::size_t b = 0; b < 4; ++b) {
+          response[4 + b] = static_cast<std::uint8_t>(angle >> (8*b));
+        }
+        estimator.onResponse(1, response, start + std::chrono::milliseconds(10*i));
+      }
+      auto const state {estimator.getState(1, start + std::chrono::milliseconds(10*199 + 5))};
+      ASSERT_TRUE(state);
+      EXPECT_NEAR(state->velocity, velocity, 1.0);
+      EXPECT_NEAR(state->position, velocity*1.995, 0.1);
+    }
+
+  }
+}
@@ -0,0 +1,108 @@
+/**
+ * \file thermal_model_test.cpp
+ * \mainpage
+ *    Tests for the thermal model predicting the temperature from the current
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <chrono>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/estimation/thermal_model.hpp"
+#include "myactuator_rmd/actuator_constants.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    // Parameters of an X8 Pro V2 with a steady-state temperature rise of 49.8 Kelvin at the rated current
+    constexpr myactuator_rmd::ThermalParameters parameters {myactuator_rmd::X8ProV2::rated_current,
+                                                            myactuator_rmd::X8ProV2::rated_power, 1.5f, 600.0f, 0.8f};
+
+    TEST(ThermalModelTest, invalidParameters) {
+      EXPECT_THROW(myactuator_rmd::ThermalModel(myactuator_rmd::ThermalParameters(0.0f, 166.0f)), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::ThermalModel(myactuator_rmd::ThermalParameters(5.0f, 166.0f, 0.0f)), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::ThermalModel(myactuator_rmd::ThermalParameters(5.0f, 166.0f, 1.5f, 600.0f, 1.5f)), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::ThermalModel(parameters, 0.0f), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::ThermalModel(parameters, 0.5f, std::chrono::seconds(-1)), myactuator_rmd::ValueRangeException);
+    }
+
+    TEST(ThermalModelTest, seedsFromFeedback) {
+      myactuator_rmd::ThermalModel model {parameters};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      EXPECT_FALSE(model.getTemperature(1, start));
+      // Feedback with a temperature of 50 degree Celsius
+      model.onResponse(1, {0xA1, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, start);
+      auto const temperature {model.getTemperature(1, start)};
+      ASSERT_TRUE(temperature);
+      EXPECT_NEAR(*temperature, 50.0f, 1.0e-4f);
+      EXPECT_FALSE(model.getTemperature(0, start));
+      EXPECT_FALSE(model.getTemperature(33, start));
+    }
+
+    TEST(ThermalModelTest, heatsUpWithCurrent) {
+      myactuator_rmd::ThermalModel model {parameters};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      // Temperature of 25 degree Celsius followed by a feedback with the rated current of 5 Ampere
+      model.onResponse(1, {0x9A, 0x19, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00}, start);
+      model.onResponse(1, {0xA1, 0x32, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x00}, start);
+      auto const initial_temperature {model.getTemperature(1, start)};
+      ASSERT_TRUE(initial_temperature);
+      EXPECT_NEAR(*initial_temperature, 25.0f, 1.0e-4f);
+      auto const temperature {model.getTemperature(1, start + std::chrono::seconds(600))};
+      ASSERT_TRUE(temperature);
+      EXPECT_NEAR(*temperature, 25.0f + 49.8f*(1.0f - std::exp(-1.0f)), 1.0e-2f);
+      auto const steady_state_temperature {model.getTemperature(1, start + std::chrono::hours(10))};
+      ASSERT_TRUE(steady_state_temperature);
+      EXPECT_NEAR(*steady_state_temperature, 25.0f + 49.8f, 1.0e-2f);
+    }
+
+    TEST(ThermalModelTest, keepsTemperatureAcrossFeedback) {
+      // The temperature contained in the feedback is not used for correcting the model
+      myactuator_rmd::ThermalModel model {parameters, 0.5f, std::chrono::hours(1)};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      model.onResponse(1, {0x9A, 0x19, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00}, start);
+      model.onResponse(1, {0xA1, 0x32, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x00}, start);
+      // Switching off the current half way does not lose the heat accumulated so far
+      model.onResponse(1, {0xA1, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, start + std::chrono::seconds(600));
+      auto const temperature {model.getTemperature(1, start + std::chrono::seconds(1200))};
+      ASSERT_TRUE(temperature);
+      EXPECT_NEAR(*temperature, 25.0f + 49.8f*(1.0f - std::exp(-1.0f))*std::exp(-1.0f), 1.0e-2f);
+    }
+
+    TEST(ThermalModelTest, correctsWithMeasurement) {
+      myactuator_rmd::ThermalModel model {parameters, 0.5f};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      model.onResponse(1, {0x9A, 0x19, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00}, start);
+      // Measured 35 degree Celsius while 25 degree Celsius were predicted without any current
+      model.onResponse(1, {0x9A, 0x23, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00}, start + std::chrono::seconds(1));
+      auto const temperature {model.getTemperature(1, start + std::chrono::seconds(1))};
+      ASSERT_TRUE(temperature);
+      EXPECT_NEAR(*temperature, 30.0f, 1.0e-4f);
+      // The ambient temperature was corrected as well so that the estimate does not decay back
+      auto const later_temperature {model.getTemperature(1, start + std::chrono::hours(1))};
+      ASSERT_TRUE(later_temperature);
+      EXPECT_NEAR(*later_temperature, 30.0f, 1.0e-4f);
+    }
+
+    TEST(ThermalModelTest, correctsWithFeedbackAtLowRate) {
+      myactuator_rmd::ThermalModel model {parameters, 0.5f, std::chrono::seconds(1)};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      model.onResponse(1, {0x9A, 0x19, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00}, start);
+      // Feedback measuring 35 degree Celsius without any current only corrects once the period has passed
+      model.onResponse(1, {0xA1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, start + std::chrono::milliseconds(500));
+      auto const uncorrected_temperature {model.getTemperature(1, start + std::chrono::milliseconds(500))};
+      ASSERT_TRUE(uncorrected_temperature);
+      EXPECT_NEAR(*uncorrected_temperature, 25.0f, 1.0e-4f);
+      model.onResponse(1, {0xA1, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, start + std::chrono::seconds(1));
+      auto const temperature {model.getTemperature(1, start + std::chrono::seconds(1))};
+      ASSERT_TRUE(temperature);
+      EXPECT_NEAR(*temperature, 30.0f, 1.0e-4f);
+    }
+
+  }
+}
@@ -0,0 +1,129 @@
+/**
+ * \file frame_decoder_benchmark.cpp
+ * \mainpage
+ *    Microbenchmark of the throughput of decoding a bus capture in frames per second
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/protocol/feedback_decoder.hpp"
+#include "myactuator_rmd/protocol/frame_decoder.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+static void BM_FrameDecoder(::benchmark::State& state) {
+  // Capture of a control loop interleaving feedback, status and angle responses with a few unknown frames
+  std::vector<std::array<std::uint8_t,8>> const capture {
+    {0xA2, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00},
+    {0x9A, 0x32, 0x00, 0x01, 0xE5, 0x01, 0x04, 0x00},
+    {0xA1, 0x32, 0x9C, 0xFF, 0x0C, 0xFE, 0xD3, 0xFF},
+    {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00},
+    {0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00},
+    {0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xA4, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00},
+    {0x9D, 0x32, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00}
+  };
+  std::size_t i {0};
+  for (auto _: state) {
+    auto const response {myactuator_rmd::FrameDecoder::decodeResponse(capture[i])};
+    ::benchmark::DoNotOptimize(response);
+    i = (i + 1) % capture.size();
+  }
+  state.counters["frames"] = ::benchmark::Counter(static_cast<double>(state.iterations()), ::benchmark::Counter::kIsRate);
+  return;
+}
+BENCHMARK(BM_FrameDecoder);
+
+static void BM_FrameDecoderVisit(::benchmark::State& state) {
+  std::vector<std::array<std::uint8_t,8>> const capture {
+    {0xA2, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00},
+    {0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00},
+    {0xA1, 0x32, 0x9C, 0xFF, 0x0C, 0xFE, 0xD3, 0xFF},
+    {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}
+  };
+  std::size_t i {0};
+  for (auto _: state) {
+    // Extract the shaft speed of all feedback responses as a logger would
+    auto const response {myactuator_rmd::FrameDecoder::decodeResponse(capture[i])};
+    float const shaft_speed {std::visit([](auto const& message) -> float {
+      using M = std::decay_t<decltype(message)>;
+      if constexpr (std::is_same_v<M,myactuator_rmd::GetMotorStatus2Response> ||
+                    std::is_same_v<M,myactuator_rmd::SetPositionAbsoluteResponse> ||
+                    std::is_same_v<M,myactuator_rmd::SetTorqueResponse> ||
+                    std::is_same_v<M,myactuator_rmd::SetVelocityResponse>) {
+        return message.getStatus().shaft_speed;
+      } else {
+        return 0.0f;
+      }
+    }, response)};
+    ::benchmark::DoNotOptimize(shaft_speed);
+    i = (i + 1) % capture.size();
+  }
+  state.counters["frames"] = ::benchmark::Counter(static_cast<double>(state.iterations()), ::benchmark::Counter::kIsRate);
+  return;
+}
+BENCHMARK(BM_FrameDecoderVisit);
+
+/**\fn makeFeedbackCapture
+ * \brief
+ *    Generate a capture of feedback responses with varying values
+ *
+ * \param[in] num_responses
+ *    The number of responses in the capture
+ * \return
+ *    The data of the feedback responses
+*/
+static std::vector<std::array<std::uint8_t,8>> makeFeedbackCapture(std::size_t const num_responses) {
+  std::vector<std::array<std::uint8_t,8>> capture (num_responses);
+  for (std::size_t i = 0; i < num_responses; ++i) {
+    auto const value {static_cast<std::uint8_t>(i)};
+    capture[i] = {0xA1, value, value, 0x00, value, 0xFF, value, 0x01};
+  }
+  return capture;
+}
+
+static void BM_FeedbackScalar(::benchmark::State& state) {
+  auto const capture {makeFeedbackCapture(static_cast<std::size_t>(state.range(0)))};
+  std::vector<myactuator_rmd::Feedback> feedback (capture.size());
+  for (auto _: state) {
+    for (std::size_t i = 0; i < capture.size(); ++i) {
+      feedback[i] = myactuator_rmd::SetTorqueResponse{capture[i]}.getStatus();
+    }
+    ::benchmark::DoNotOptimize(feedback.data());
+    ::benchmark::ClobberMemory();
+  }
+  state.counters["frames"] = ::benchmark::Counter(static_cast<double>(state.iterations()*capture.size()),
+                                                  ::benchmark::Counter::kIsRate);
+  return;
+}
+BENCHMARK(BM_FeedbackScalar)->Arg(1024);
+
+static void BM_FeedbackBatch(::benchmark::State& state) {
+  auto const capture {makeFeedbackCapture(static_cast<std::size_t>(state.range(0)))};
+  std::vector<int> temperature (capture.size());
+  std::vector<float> current (capture.size());
+  std::vector<float> shaft_speed (capture.size());
+  std::vector<float> shaft_angle (capture.size());
+  myactuator_rmd::FeedbackArrays const feedback {temperature.data(), current.data(), shaft_speed.data(), shaft_angle.data()};
+  for (auto _: state) {
+    myactuator_rmd::decodeFeedback(capture.data(), capture.size(), feedback);
+    ::benchmark::DoNotOptimize(current.data());
+    ::benchmark::ClobberMemory();
+  }
+  state.counters["frames"] = ::benchmark::Counter(static_cast<double>(state.iterations()*capture.size()),
+                                                  ::benchmark::Counter::kIsRate);
+  return;
+}
+BENCHMARK(BM_FeedbackBatch)->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -1,12 +1,13 @@
 #include "actuator_adaptor.hpp"
 
-#include <array>
 #include <cstdint>
 #include <string>
+#include <variant>
 
 #include "myactuator_rmd/can/frame.hpp"
 #include "myactuator_rmd/driver/can_driver.hpp"
-#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/frame_decoder.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
 #include "myactuator_rmd/protocol/responses.hpp"
 #include "myactuator_rmd/exceptions.hpp"
 
@@ -16,9 +17,9 @@ namespace myactuator_rmd {
 
     void ActuatorAdaptor::handleRequest() {
       can::Frame const frame {read()};
-      std::array<std::uint8_t,8> const data {frame.getData()};
-      
-      if (data[0] == myactuator_rmd::CommandType::READ_SYSTEM_SOFTWARE_VERSION_DATE) {
+      auto const request {myactuator_rmd::FrameDecoder::decodeRequest(frame.getData())};
+
+      if (std::holds_alternative<myactuator_rmd::GetVersionDateRequest>(request)) {
         myactuator_rmd::GetVersionDateResponse const response {getVersionDate()};
         send(response, actuator_id_);
       } else {
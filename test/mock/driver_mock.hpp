@@ -0,0 +1,46 @@
+/**
+ * \file driver_mock.hpp
+ * \mainpage
+ *    Contains a mock for the driver that does not require any network interface
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#ifndef MYACTUATOR_RMD__TEST__MOCK__DRIVER_MOCK
+#define MYACTUATOR_RMD__TEST__MOCK__DRIVER_MOCK
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <gmock/gmock.h>
+
+#include "myactuator_rmd/driver/driver.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    /**\class DriverMock
+     * \brief
+     *    Mock of a driver that can be used for testing classes built on top of a driver in-process
+    */
+    class DriverMock: public myactuator_rmd::Driver {
+      public:
+        DriverMock() = default;
+        DriverMock(DriverMock const&) = delete;
+        DriverMock& operator = (DriverMock const&) = delete;
+        DriverMock(DriverMock&&) = delete;
+        DriverMock& operator = (DriverMock&&) = delete;
+
+        // Register all the virtual methods of the driver as mock methods so we can control their behavior
+        MOCK_METHOD(void, addId, (std::uint32_t const), (override));
+        MOCK_METHOD(void, send, (Message const&, std::uint32_t const), (override));
+        MOCK_METHOD((std::array<std::uint8_t,8>), sendRecv, (Message const&, std::uint32_t const), (override));
+    };
+
+  }
+}
+
+#endif // MYACTUATOR_RMD__TEST__MOCK__DRIVER_MOCK
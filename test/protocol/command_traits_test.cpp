@@ -0,0 +1,66 @@
+/**
+ * \file command_traits_test.cpp
+ * \mainpage
+ *    Tests for the compile-time command registry and the generic typed call
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_2.hpp"
+#include "myactuator_rmd/protocol/command_traits.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/actuator_interface.hpp"
+#include "../mock/driver_mock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    static_assert(std::is_same_v<CommandTraits<CommandType::READ_MOTOR_STATUS_2>::Request, GetMotorStatus2Request>);
+    static_assert(std::is_same_v<CommandTraits<CommandType::READ_MOTOR_STATUS_2>::Response, GetMotorStatus2Response>);
+    static_assert(std::is_same_v<CommandTraits<CommandType::READ_MOTOR_STATUS_2>::Result, MotorStatus2>);
+    static_assert(std::is_same_v<CommandTraits<CommandType::READ_SYSTEM_RUNTIME>::Result, std::chrono::milliseconds>);
+    static_assert(std::is_void_v<CommandTraits<CommandType::STOP_MOTOR>::Result>);
+    static_assert(CommandTraits<CommandType::STOP_MOTOR>::is_reply_expected);
+    static_assert(!CommandTraits<CommandType::RESET_SYSTEM>::is_reply_expected);
+
+    TEST(CommandTraitsTest, callDecodesResponse) {
+      ::testing::NiceMock<DriverMock> driver {};
+      EXPECT_CALL(driver, sendRecv(::testing::_, 1)).WillOnce([](Message const& request, std::uint32_t const) {
+        EXPECT_EQ(request.getData(), (std::array<std::uint8_t,8>{0xA2, 0x00, 0x00, 0x00, 0x50, 0xC3, 0x00, 0x00}));
+        return std::array<std::uint8_t,8>{0xA2, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00};
+      });
+      Feedback const feedback {myactuator_rmd::call<CommandType::SPEED_CLOSED_LOOP_CONTROL>(driver, 1, 500.0f)};
+      EXPECT_EQ(feedback.temperature, 50);
+      EXPECT_NEAR(feedback.shaft_speed, 500.0f, 0.1f);
+    }
+
+    TEST(CommandTraitsTest, callWithoutReplyOnlySends) {
+      ::testing::NiceMock<DriverMock> driver {};
+      EXPECT_CALL(driver, sendRecv).Times(0);
+      EXPECT_CALL(driver, send(::testing::_, 2)).Times(1);
+      myactuator_rmd::call<CommandType::RESET_SYSTEM>(driver, 2);
+    }
+
+    TEST(CommandTraitsTest, actuatorInterfaceCall) {
+      ::testing::NiceMock<DriverMock> driver {};
+      EXPECT_CALL(driver, sendRecv(::testing::_, 1)).WillOnce(::testing::Return(
+        std::array<std::uint8_t,8>{0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}));
+      myactuator_rmd::ActuatorInterface actuator {driver, 1};
+      EXPECT_NEAR(actuator.call<CommandType::READ_MULTI_TURN_ANGLE>(), 360.0f, 0.1f);
+    }
+
+  }
+}
@@ -0,0 +1,56 @@
+/**
+ * \file feedback_decoder_test.cpp
+ * \mainpage
+ *    Tests for decoding batches of feedback responses
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/protocol/feedback_decoder.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(FeedbackDecoderTest, matchesResponses) {
+      // Odd number of responses so that both the vectorised and the scalar decoder are used
+      std::vector<std::array<std::uint8_t,8>> const data {
+        {0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00},
+        {0xA2, 0x32, 0x9C, 0xFF, 0x0C, 0xFE, 0xD3, 0xFF},
+        {0xA1, 0xF6, 0xFF, 0x7F, 0x00, 0x80, 0xFF, 0x7F},
+        {0xA4, 0x7F, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x80},
+        {0x9C, 0x80, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x00},
+        {0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0xA1, 0x19, 0x2C, 0x01, 0x9C, 0xFF, 0x68, 0x01}
+      };
+      std::vector<int> temperature (data.size());
+      std::vector<float> current (data.size());
+      std::vector<float> shaft_speed (data.size());
+      std::vector<float> shaft_angle (data.size());
+      decodeFeedback(data.data(), data.size(), FeedbackArrays{temperature.data(), current.data(), shaft_speed.data(), shaft_angle.data()});
+      for (std::size_t i = 0; i < data.size(); ++i) {
+        Feedback const expected {GetMotorStatus2Response::decode(data[i].data())};
+        EXPECT_EQ(temperature[i], expected.temperature);
+        EXPECT_EQ(current[i], expected.current);
+        EXPECT_EQ(shaft_speed[i], expected.shaft_speed);
+        EXPECT_EQ(shaft_angle[i], expected.shaft_angle);
+      }
+      EXPECT_EQ(temperature[0], 50);
+      EXPECT_NEAR(current[1], -1.0f, 0.001f);
+      EXPECT_EQ(temperature[2], -10);
+      EXPECT_NEAR(current[2], 327.67f, 0.01f);
+      EXPECT_EQ(shaft_speed[2], -32768.0f);
+      EXPECT_EQ(temperature[4], -128);
+    }
+
+  }
+}
@@ -0,0 +1,67 @@
+/**
+ * \file frame_decoder_test.cpp
+ * \mainpage
+ *    Tests for decoding arbitrary frames into the corresponding requests and responses
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <cstdint>
+#include <variant>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/protocol/frame_decoder.hpp"
+#include "myactuator_rmd/protocol/requests.hpp"
+#include "myactuator_rmd/protocol/responses.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(FrameDecoderTest, decodeRequest) {
+      auto const request {FrameDecoder::decodeRequest({0xA2, 0x00, 0x00, 0x00, 0x10, 0x27, 0x00, 0x00})};
+      ASSERT_TRUE(std::holds_alternative<SetVelocityRequest>(request));
+      EXPECT_NEAR(std::get<SetVelocityRequest>(request).getSpeed(), 100.0f, 0.1f);
+      EXPECT_TRUE(std::holds_alternative<ResetRequest>(FrameDecoder::decodeRequest(ResetRequest{}.getData())));
+    }
+
+    TEST(FrameDecoderTest, decodeResponse) {
+      auto const response {FrameDecoder::decodeResponse({0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00})};
+      ASSERT_TRUE(std::holds_alternative<GetMotorStatus2Response>(response));
+      Feedback const feedback {std::get<GetMotorStatus2Response>(response).getStatus()};
+      EXPECT_EQ(feedback.temperature, 50);
+      EXPECT_NEAR(feedback.shaft_speed, 500.0f, 0.1f);
+    }
+
+    TEST(FrameDecoderTest, decodeCanId) {
+      EXPECT_TRUE(std::holds_alternative<GetCanIdRequest>(FrameDecoder::decodeRequest(GetCanIdRequest{}.getData())));
+      auto const request {FrameDecoder::decodeRequest(SetCanIdRequest{3}.getData())};
+      ASSERT_TRUE(std::holds_alternative<SetCanIdRequest>(request));
+      auto const response {FrameDecoder::decodeResponse({0x79, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x02})};
+      ASSERT_TRUE(std::holds_alternative<GetCanIdResponse>(response));
+      EXPECT_EQ(std::get<GetCanIdResponse>(response).getCanId(), 0x241);
+    }
+
+    TEST(FrameDecoderTest, decodeUnknown) {
+      EXPECT_TRUE(std::holds_alternative<std::monostate>(FrameDecoder::decodeRequest({0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00})));
+      // Resetting the actuator does not trigger a response
+      EXPECT_TRUE(std::holds_alternative<std::monostate>(FrameDecoder::decodeResponse({0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00})));
+    }
+
+    TEST(FrameDecoderTest, visit) {
+      auto const request {FrameDecoder::decodeRequest(StopMotorRequest{}.getData())};
+      auto const command {std::visit([](auto const& message) -> int {
+        if constexpr (std::is_same_v<std::decay_t<decltype(message)>,std::monostate>) {
+          return -1;
+        } else {
+          return static_cast<int>(message.getData()[0]);
+        }
+      }, request)};
+      EXPECT_EQ(command, 0x81);
+    }
+
+  }
+}
@@ -150,5 +150,45 @@ namespace myactuator_rmd {
       EXPECT_NEAR(speed, -100.0f, 0.1f);
     }
 
+    TEST(SetVelocityRequestTest, constexprEncoding) {
+      constexpr myactuator_rmd::SetVelocityRequest request {-100.0f};
+      static_assert((request.getData()[4] == 0xF0) && (request.getData()[5] == 0xD8));
+      static_assert((request.getData()[6] == 0xFF) && (request.getData()[7] == 0xFF));
+      static_assert(request.getSpeed() == -100.0f);
+    }
+
+    TEST(SetPositionAbsoluteRequestTest, constexprEncoding) {
+      constexpr myactuator_rmd::SetPositionAbsoluteRequest request {180.0f, 500.0f};
+      static_assert((request.getData()[2] == 0xF4) && (request.getData()[3] == 0x01));
+      static_assert((request.getData()[4] == 0x50) && (request.getData()[5] == 0x46));
+      static_assert(request.getMaxSpeed() == 500.0f);
+      static_assert(request.getPosition() == 180.0f);
+    }
+
+    TEST(SetPositionAbsoluteRequestTest, rawEncoding) {
+      constexpr auto request {myactuator_rmd::SetPositionAbsoluteRequest::fromRaw(18000, 500)};
+      static_assert((request.getData()[2] == 0xF4) && (request.getData()[3] == 0x01));
+      static_assert((request.getData()[4] == 0x50) && (request.getData()[5] == 0x46));
+      static_assert(request.getMaxSpeedRaw() == 500);
+      static_assert(request.getPositionRaw() == 18000);
+      EXPECT_EQ(request.getData(), (myactuator_rmd::SetPositionAbsoluteRequest{180.0f, 500.0f}.getData()));
+    }
+
+    TEST(SetTorqueRequestTest, rawEncoding) {
+      constexpr auto request {myactuator_rmd::SetTorqueRequest::fromRaw(-100)};
+      static_assert(request.getData()[0] == 0xA1);
+      static_assert((request.getData()[4] == 0x9C) && (request.getData()[5] == 0xFF));
+      static_assert(request.getTorqueCurrentRaw() == -100);
+      EXPECT_EQ(request.getData(), myactuator_rmd::SetTorqueRequest{-1.0f}.getData());
+    }
+
+    TEST(SetVelocityRequestTest, rawEncoding) {
+      constexpr auto request {myactuator_rmd::SetVelocityRequest::fromRaw(-10000)};
+      static_assert((request.getData()[4] == 0xF0) && (request.getData()[5] == 0xD8));
+      static_assert((request.getData()[6] == 0xFF) && (request.getData()[7] == 0xFF));
+      static_assert(request.getSpeedRaw() == -10000);
+      EXPECT_EQ(request.getData(), myactuator_rmd::SetVelocityRequest{-100.0f}.getData());
+    }
+
   }
 }
@@ -0,0 +1,64 @@
+/**
+ * \file response_view_test.cpp
+ * \mainpage
+ *    Tests for decoding responses directly from a receive buffer
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+#include <linux/can.h>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/actuator_state/motor_status_1.hpp"
+#include "myactuator_rmd/protocol/response_view.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    static_assert(std::is_trivially_copyable_v<GetMotorStatus2ResponseView>);
+    static_assert(sizeof(GetMotorStatus2ResponseView) == sizeof(std::uint8_t const*));
+
+    TEST(ResponseViewTest, decodeFromFrameBuffer) {
+      struct ::can_frame frames[2] {};
+      frames[0].can_id = 0x241;
+      std::uint8_t const feedback_data[8] {0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00};
+      std::copy(std::begin(feedback_data), std::end(feedback_data), std::begin(frames[0].data));
+      frames[1].can_id = 0x242;
+      std::uint8_t const status_data[8] {0x9A, 0x32, 0x00, 0x01, 0xE5, 0x01, 0x04, 0x00};
+      std::copy(std::begin(status_data), std::end(status_data), std::begin(frames[1].data));
+
+      auto const feedback_view {GetMotorStatus2ResponseView::tryView(frames[0].data)};
+      ASSERT_TRUE(feedback_view);
+      EXPECT_EQ(feedback_view->getData(), frames[0].data);
+      Feedback const feedback {feedback_view->decode()};
+      EXPECT_EQ(feedback.temperature, 50);
+      EXPECT_NEAR(feedback.current, 1.0f, 0.1f);
+      EXPECT_NEAR(feedback.shaft_speed, 500.0f, 0.1f);
+      EXPECT_NEAR(feedback.shaft_angle, 45.0f, 0.1f);
+
+      EXPECT_FALSE(GetMotorStatus2ResponseView::tryView(frames[1].data));
+      auto const status_view {GetMotorStatus1ResponseView::tryView(frames[1].data)};
+      ASSERT_TRUE(status_view);
+      MotorStatus1 const status {status_view->decode()};
+      EXPECT_EQ(status.temperature, 50);
+      EXPECT_EQ(status.is_brake_released, true);
+      EXPECT_NEAR(status.voltage, 48.5f, 0.1f);
+    }
+
+    TEST(ResponseViewTest, decodeMatchesResponse) {
+      std::uint8_t const data[8] {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00};
+      auto const view {GetMultiTurnAngleResponseView::tryView(data)};
+      ASSERT_TRUE(view);
+      GetMultiTurnAngleResponse const response {{0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}};
+      EXPECT_EQ(view->decode(), response.getAngle());
+    }
+
+  }
+}
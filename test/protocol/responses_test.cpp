@@ -6,6 +6,9 @@
  *    Tobit Flatscher (github.com/2b-t)
 */
 
+#include <array>
+#include <cstdint>
+
 #include <gtest/gtest.h>
 
 #include "myactuator_rmd/actuator_state/control_mode.hpp"
@@ -15,6 +18,8 @@
 #include "myactuator_rmd/actuator_state/motor_status_2.hpp"
 #include "myactuator_rmd/actuator_state/motor_status_3.hpp"
 #include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/protocol/single_motor_message.hpp"
+#include "myactuator_rmd/exceptions.hpp"
 
 
 namespace myactuator_rmd {
@@ -200,5 +205,35 @@ namespace myactuator_rmd {
       EXPECT_NEAR(feedback.shaft_angle, -45.0f, 0.1f);
     }
 
+    TEST(SetVelocityResponseTest, constexprDecoding) {
+      constexpr myactuator_rmd::SetVelocityResponse response {{0xA2, 0x32, 0x9C, 0xFF, 0x0C, 0xFE, 0xD3, 0xFF}};
+      constexpr myactuator_rmd::Feedback feedback {response.getStatus()};
+      static_assert(feedback.temperature == 50);
+      static_assert(feedback.shaft_speed == -500.0f);
+      static_assert(feedback.shaft_angle == -45.0f);
+    }
+
+    TEST(SetVelocityResponseTest, rawDecoding) {
+      constexpr myactuator_rmd::SetVelocityResponse response {{0xA2, 0x32, 0x9C, 0xFF, 0x0C, 0xFE, 0xD3, 0xFF}};
+      constexpr myactuator_rmd::RawFeedback feedback {response.getStatusRaw()};
+      static_assert(feedback.temperature == 50);
+      static_assert(feedback.current == -100);
+      static_assert(feedback.shaft_speed == -500);
+      static_assert(feedback.shaft_angle == -45);
+    }
+
+    TEST(SetVelocityResponseTest, tryDecode) {
+      auto const response {myactuator_rmd::tryDecode<myactuator_rmd::SetVelocityResponse>({0xA2, 0x32, 0x9C, 0xFF, 0x0C, 0xFE, 0xD3, 0xFF})};
+      ASSERT_TRUE(response);
+      EXPECT_EQ(response->getStatus().temperature, 50);
+    }
+
+    TEST(SetVelocityResponseTest, tryDecodeForeignCommand) {
+      std::array<std::uint8_t,8> const data {0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00};
+      EXPECT_FALSE(myactuator_rmd::tryDecode<myactuator_rmd::SetVelocityResponse>(data));
+      EXPECT_THROW(myactuator_rmd::SetVelocityResponse{data}, myactuator_rmd::ProtocolException);
+      static_assert(!myactuator_rmd::tryDecode<myactuator_rmd::GetMultiTurnAngleResponse>({0x9C, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}));
+    }
+
   }
 }
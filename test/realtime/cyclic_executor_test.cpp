@@ -0,0 +1,83 @@
+/**
+ * \file cyclic_executor_test.cpp
+ * \mainpage
+ *    Tests for running a callback at a fixed period
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <system_error>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/realtime/cyclic_executor.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(CyclicExecutorTest, runsAtFixedPeriod) {
+      using namespace std::literals::chrono_literals;
+      std::atomic<int> num_calls {0};
+      myactuator_rmd::CyclicExecutor executor {[&num_calls]() { ++num_calls; }, ExecutorConfiguration{2ms, std::nullopt, 0}};
+      std::this_thread::sleep_for(101ms);
+      executor.stop();
+      auto const statistics {executor.getStatistics()};
+      EXPECT_EQ(statistics.num_cycles, num_calls);
+      // The period must not drift even if a few cycles are delayed
+      EXPECT_GE(statistics.num_cycles, 40);
+      EXPECT_LE(statistics.num_cycles, 51);
+      EXPECT_EQ(statistics.num_errors, 0);
+      EXPECT_LE(statistics.max_wake_up_latency, statistics.total_wake_up_latency);
+      EXPECT_LE(statistics.max_execution_time, statistics.total_execution_time);
+    }
+
+    TEST(CyclicExecutorTest, detectsDeadlineMisses) {
+      using namespace std::literals::chrono_literals;
+      std::atomic<int> num_calls {0};
+      myactuator_rmd::CyclicExecutor executor {[&num_calls]() {
+        if (++num_calls == 3) {
+          std::this_thread::sleep_for(10ms);
+        }
+      }, ExecutorConfiguration{2ms}};
+      std::this_thread::sleep_for(50ms);
+      executor.stop();
+      auto const statistics {executor.getStatistics()};
+      EXPECT_GE(statistics.num_deadline_misses, 1);
+      EXPECT_GE(statistics.num_skipped_cycles, 4);
+      EXPECT_GE(statistics.max_execution_time, 10ms);
+    }
+
+    TEST(CyclicExecutorTest, callbackCanStopExecutor) {
+      using namespace std::literals::chrono_literals;
+      std::atomic<myactuator_rmd::CyclicExecutor*> executor_ptr {nullptr};
+      std::atomic<int> num_calls {0};
+      myactuator_rmd::CyclicExecutor executor {[&]() {
+        if (++num_calls == 5) {
+          executor_ptr.load()->stop();
+        }
+        if (num_calls == 1) {
+          throw myactuator_rmd::Exception("Failed cycle");
+        }
+      }, ExecutorConfiguration{1ms}};
+      executor_ptr = &executor;
+      std::this_thread::sleep_for(50ms);
+      EXPECT_FALSE(executor.isRunning());
+      EXPECT_EQ(num_calls, 5);
+      EXPECT_EQ(executor.getStatistics().num_errors, 1);
+    }
+
+    TEST(CyclicExecutorTest, invalidConfiguration) {
+      EXPECT_THROW(myactuator_rmd::CyclicExecutor([]() {}, ExecutorConfiguration{std::chrono::nanoseconds::zero()}), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::CyclicExecutor(nullptr, ExecutorConfiguration{std::chrono::milliseconds(1)}), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::CyclicExecutor([]() {}, ExecutorConfiguration{std::chrono::milliseconds(1), 100}), std::system_error);
+    }
+
+  }
+}
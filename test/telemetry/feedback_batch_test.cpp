@@ -0,0 +1,87 @@
+/**
+ * \file feedback_batch_test.cpp
+ * \mainpage
+ *    Tests for the structure of arrays holding the feedback of several actuators
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <linux/can.h>
+
+#include "myactuator_rmd/actuator_state/feedback.hpp"
+#include "myactuator_rmd/telemetry/feedback_batch.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(FeedbackBatchTest, alignedAndPadded) {
+      myactuator_rmd::FeedbackBatch const batch {{1, 2, 3}};
+      EXPECT_EQ(batch.size(), 3);
+      EXPECT_EQ(batch.getCapacity() % myactuator_rmd::FeedbackBatch::alignment, 0);
+      EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.getCurrent()) % myactuator_rmd::FeedbackBatch::alignment, 0);
+      EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.getShaftAngle()) % myactuator_rmd::FeedbackBatch::alignment, 0);
+      for (std::size_t i = 0; i < batch.getCapacity(); ++i) {
+        EXPECT_EQ(batch.getValid()[i], 0);
+        EXPECT_EQ(batch.getShaftSpeed()[i], 0.0f);
+      }
+      EXPECT_FALSE(batch.isComplete());
+    }
+
+    TEST(FeedbackBatchTest, update) {
+      myactuator_rmd::FeedbackBatch batch {{4, 2}};
+      std::chrono::steady_clock::time_point const timestamp {std::chrono::seconds(1)};
+      EXPECT_TRUE(batch.update(2, {0xA2, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, timestamp));
+      EXPECT_FALSE(batch.update(3, {0xA2, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, timestamp));
+      EXPECT_FALSE(batch.update(4, {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}, timestamp));
+      EXPECT_FALSE(batch.isComplete());
+      EXPECT_EQ(batch.getValid()[0], 0);
+      EXPECT_NE(batch.getValid()[1], 0);
+      EXPECT_EQ(batch.getTemperature()[1], 50);
+      EXPECT_NEAR(batch.getCurrent()[1], 1.0f, 0.01f);
+      EXPECT_NEAR(batch.getShaftSpeed()[1], 500.0f, 0.1f);
+      EXPECT_NEAR(batch.getShaftAngle()[1], 45.0f, 0.1f);
+      myactuator_rmd::Feedback const feedback {batch.getFeedback(1)};
+      EXPECT_EQ(feedback.temperature, 50);
+      EXPECT_EQ(batch.getAge(1, timestamp + std::chrono::milliseconds(5)), std::chrono::milliseconds(5));
+      EXPECT_TRUE(batch.update(4, {0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, timestamp));
+      EXPECT_TRUE(batch.isComplete());
+    }
+
+    TEST(FeedbackBatchTest, updateFromFrameData) {
+      myactuator_rmd::FeedbackBatch batch {{1}};
+      struct ::can_frame frame {};
+      frame.can_id = 0x241;
+      frame.len = 8;
+      std::array<std::uint8_t,8> const data {0xA1, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00};
+      std::copy(data.begin(), data.end(), std::begin(frame.data));
+      EXPECT_TRUE(batch.update(1, frame.data));
+      EXPECT_TRUE(batch.isComplete());
+      EXPECT_NEAR(batch.getShaftSpeed()[0], 500.0f, 0.1f);
+    }
+
+    TEST(FeedbackBatchTest, invalidate) {
+      myactuator_rmd::FeedbackBatch batch {{1, 2}};
+      std::chrono::steady_clock::time_point const timestamp {std::chrono::seconds(1)};
+      static_cast<void>(batch.update(1, {0xA1, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, timestamp));
+      static_cast<void>(batch.update(2, {0xA1, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, timestamp + std::chrono::milliseconds(10)));
+      batch.invalidateOlderThan(std::chrono::milliseconds(5), timestamp + std::chrono::milliseconds(12));
+      EXPECT_EQ(batch.getValid()[0], 0);
+      EXPECT_NE(batch.getValid()[1], 0);
+      batch.invalidate();
+      EXPECT_EQ(batch.getValid()[1], 0);
+      EXPECT_EQ(batch.getIndex(2), 1);
+      EXPECT_FALSE(batch.getIndex(5));
+    }
+
+  }
+}
@@ -0,0 +1,96 @@
+/**
+ * \file feedback_ring_test.cpp
+ * \mainpage
+ *    Tests for the lock-free ring buffers holding the recent feedback of each actuator
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/telemetry/feedback_ring.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    /**\fn makeResponse
+     * \brief
+     *    Creates a speed control response whose shaft angle encodes the given value
+    */
+    std::array<std::uint8_t,8> makeResponse(std::uint16_t const value) {
+      return {0xA2, 0x32, 0x00, 0x00, 0x00, 0x00, static_cast<std::uint8_t>(value & 0xFF), static_cast<std::uint8_t>(value >> 8)};
+    }
+
+    TEST(FeedbackRingTest, invalidCapacity) {
+      EXPECT_THROW(myactuator_rmd::FeedbackRing{0}, myactuator_rmd::ValueRangeException);
+    }
+
+    TEST(FeedbackRingTest, partiallyFilled) {
+      myactuator_rmd::FeedbackRing ring {8};
+      std::array<myactuator_rmd::StampedFeedback,4> samples {};
+      EXPECT_EQ(ring.getLatest(1, samples.data(), samples.size()), 0);
+      ring.onResponse(1, makeResponse(1), std::chrono::steady_clock::time_point{std::chrono::seconds(1)});
+      ring.onResponse(1, makeResponse(2), std::chrono::steady_clock::time_point{std::chrono::seconds(2)});
+      ring.onResponse(1, {0x9A, 0x32, 0x00, 0x01, 0xE5, 0x01, 0x04, 0x00}, std::chrono::steady_clock::time_point{std::chrono::seconds(3)});
+      ring.onResponse(2, makeResponse(3), std::chrono::steady_clock::time_point{std::chrono::seconds(3)});
+      ASSERT_EQ(ring.getLatest(1, samples.data(), samples.size()), 2);
+      EXPECT_EQ(samples[0].feedback.shaft_angle, 1.0f);
+      EXPECT_EQ(samples[0].timestamp, std::chrono::steady_clock::time_point{std::chrono::seconds(1)});
+      EXPECT_EQ(samples[1].feedback.shaft_angle, 2.0f);
+      EXPECT_EQ(ring.getCount(1), 2);
+      EXPECT_EQ(ring.getCount(2), 1);
+      EXPECT_EQ(ring.getCount(33), 0);
+    }
+
+    TEST(FeedbackRingTest, wrapsAround) {
+      myactuator_rmd::FeedbackRing ring {4};
+      for (std::uint16_t i = 0; i < 10; ++i) {
+        ring.onResponse(1, makeResponse(i), std::chrono::steady_clock::time_point{std::chrono::seconds(i)});
+      }
+      std::array<myactuator_rmd::StampedFeedback,6> samples {};
+      ASSERT_EQ(ring.getLatest(1, samples.data(), samples.size()), 4);
+      for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(samples[i].feedback.shaft_angle, static_cast<float>(6 + i));
+      }
+      ASSERT_EQ(ring.getLatest(1, samples.data(), 2), 2);
+      EXPECT_EQ(samples[0].feedback.shaft_angle, 8.0f);
+      EXPECT_EQ(samples[1].feedback.shaft_angle, 9.0f);
+    }
+
+    TEST(FeedbackRingTest, consistentConcurrentSnapshots) {
+      myactuator_rmd::FeedbackRing ring {16};
+      std::atomic<bool> is_running {true};
+      std::thread writer {[&ring, &is_running]() {
+        for (std::uint16_t i = 0; is_running.load(); ++i) {
+          ring.onResponse(1, makeResponse(i), std::chrono::steady_clock::time_point{std::chrono::nanoseconds(i)});
+        }
+        return;
+      }};
+      std::array<myactuator_rmd::StampedFeedback,16> samples {};
+      for (int i = 0; i < 20000; ++i) {
+        auto const num_samples {ring.getLatest(1, samples.data(), samples.size())};
+        for (std::size_t j = 0; j < num_samples; ++j) {
+          // The angle and the timestamp are written together and consecutive entries are consecutive integers
+          auto const value {static_cast<std::uint16_t>(static_cast<std::int16_t>(samples[j].feedback.shaft_angle))};
+          ASSERT_EQ(samples[j].timestamp.time_since_epoch().count(), value);
+          if (j > 0) {
+            auto const previous {static_cast<std::uint16_t>(static_cast<std::int16_t>(samples[j-1].feedback.shaft_angle))};
+            ASSERT_EQ(static_cast<std::uint16_t>(previous + 1), value);
+          }
+        }
+      }
+      is_running.store(false);
+      writer.join();
+    }
+
+  }
+}
@@ -0,0 +1,106 @@
+/**
+ * \file power_monitor_test.cpp
+ * \mainpage
+ *    Tests for the accumulator of the estimated electrical power and energy
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/telemetry/power_monitor.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    // Torque constant of 2.6 Nm/A and winding resistance of 1 Ohm
+    constexpr float torque_constant {2.6f};
+    constexpr float resistance {1.0f};
+    // Mechanical power at 2 Ampere and 180 degree per second as well as the copper losses at 2 Ampere
+    constexpr float power {torque_constant*2.0f*3.14159265f + resistance*2.0f*2.0f};
+
+    TEST(PowerMonitorTest, invalidParameters) {
+      EXPECT_THROW(myactuator_rmd::PowerMonitor(0.0f, resistance), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::PowerMonitor(torque_constant, -1.0f), myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::PowerMonitor(torque_constant, resistance, std::chrono::seconds(0)), myactuator_rmd::ValueRangeException);
+    }
+
+    TEST(PowerMonitorTest, noResponses) {
+      myactuator_rmd::PowerMonitor monitor {torque_constant, resistance};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      monitor.onResponse(1, {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}, start);
+      EXPECT_FALSE(monitor.getPowerState(1));
+      EXPECT_FALSE(monitor.getPowerState(0));
+      EXPECT_FALSE(monitor.getPowerState(33));
+      auto const total {monitor.getTotalPowerState()};
+      EXPECT_EQ(total.power, 0.0f);
+      EXPECT_EQ(total.energy, 0.0);
+    }
+
+    TEST(PowerMonitorTest, integratesEnergy) {
+      myactuator_rmd::PowerMonitor monitor {torque_constant, resistance, std::chrono::seconds(1)};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      // Bus voltage of 48 Volt followed by a feedback with 2 Ampere and 180 degree per second every 10 milliseconds
+      monitor.onResponse(1, {0x9A, 0x19, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00}, start);
+      for (int i = 0; i <= 100; ++i) {
+        monitor.onResponse(1, {0xA1, 0x32, 0xC8, 0x00, 0xB4, 0x00, 0x00, 0x00}, start + std::chrono::milliseconds(10*i));
+      }
+      auto const state {monitor.getPowerState(1)};
+      ASSERT_TRUE(state);
+      EXPECT_NEAR(state->voltage, 48.0f, 1.0e-4f);
+      EXPECT_NEAR(state->power, power, 1.0e-3f);
+      EXPECT_NEAR(state->current, power/48.0f, 1.0e-4f);
+      EXPECT_NEAR(state->energy, power, 1.0e-3);
+      EXPECT_NEAR(state->average_power, power, 1.0e-3f);
+    }
+
+    TEST(PowerMonitorTest, onlyCopperLossesAtStall) {
+      myactuator_rmd::PowerMonitor monitor {torque_constant, resistance};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      // Current of -2 Ampere without any motion
+      monitor.onResponse(1, {0xA1, 0x32, 0x38, 0xFF, 0x00, 0x00, 0x00, 0x00}, start);
+      monitor.onResponse(1, {0xA1, 0x32, 0x38, 0xFF, 0x00, 0x00, 0x00, 0x00}, start + std::chrono::milliseconds(500));
+      auto const state {monitor.getPowerState(1)};
+      ASSERT_TRUE(state);
+      EXPECT_NEAR(state->power, 4.0f, 1.0e-4f);
+      EXPECT_NEAR(state->energy, 2.0, 1.0e-4);
+      // Without a bus voltage the current can not be estimated and the first window is not completed yet
+      EXPECT_EQ(state->voltage, 0.0f);
+      EXPECT_EQ(state->current, 0.0f);
+      EXPECT_EQ(state->average_power, 0.0f);
+    }
+
+    TEST(PowerMonitorTest, brakingIsNotFedBack) {
+      myactuator_rmd::PowerMonitor monitor {torque_constant, resistance};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      // Current of -2 Ampere opposing a speed of 180 degree per second
+      monitor.onResponse(1, {0xA1, 0x32, 0x38, 0xFF, 0xB4, 0x00, 0x00, 0x00}, start);
+      auto const state {monitor.getPowerState(1)};
+      ASSERT_TRUE(state);
+      EXPECT_NEAR(state->power, power, 1.0e-3f);
+    }
+
+    TEST(PowerMonitorTest, sumsBus) {
+      myactuator_rmd::PowerMonitor monitor {torque_constant, resistance};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(1)};
+      monitor.onResponse(1, {0x9A, 0x19, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00}, start);
+      monitor.onResponse(1, {0xA1, 0x32, 0xC8, 0x00, 0xB4, 0x00, 0x00, 0x00}, start);
+      // Bus voltage of 47 Volt and a current of 1 Ampere without any motion
+      monitor.onResponse(2, {0x9A, 0x19, 0x00, 0x00, 0xD6, 0x01, 0x00, 0x00}, start);
+      monitor.onResponse(2, {0xA2, 0x32, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00}, start);
+      monitor.onResponse(1, {0xA1, 0x32, 0xC8, 0x00, 0xB4, 0x00, 0x00, 0x00}, start + std::chrono::seconds(1));
+      monitor.onResponse(2, {0xA2, 0x32, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00}, start + std::chrono::seconds(1));
+      auto const total {monitor.getTotalPowerState()};
+      EXPECT_NEAR(total.voltage, 47.5f, 1.0e-4f);
+      EXPECT_NEAR(total.current, power/48.0f + 1.0f/47.0f, 1.0e-4f);
+      EXPECT_NEAR(total.power, power + 1.0f, 1.0e-3f);
+      EXPECT_NEAR(total.average_power, power + 1.0f, 1.0e-3f);
+      EXPECT_NEAR(total.energy, power + 1.0f, 1.0e-3);
+    }
+
+  }
+}
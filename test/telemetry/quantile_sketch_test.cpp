@@ -0,0 +1,92 @@
+/**
+ * \file quantile_sketch_test.cpp
+ * \mainpage
+ *    Tests for the streaming quantile sketch
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <chrono>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/telemetry/quantile_sketch.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(QuantileSketchTest, emptySketch) {
+      myactuator_rmd::QuantileSketch const sketch {};
+      EXPECT_EQ(sketch.getCount(), 0);
+      EXPECT_EQ(sketch.getQuantile(0.5), std::chrono::nanoseconds::zero());
+    }
+
+    TEST(QuantileSketchTest, quantilesWithinRelativeAccuracy) {
+      constexpr double relative_accuracy {0.01};
+      myactuator_rmd::QuantileSketch sketch {relative_accuracy};
+      for (std::int64_t i = 1; i <= 10000; ++i) {
+        sketch.add(std::chrono::microseconds(i));
+      }
+      EXPECT_EQ(sketch.getCount(), 10000);
+      for (double const quantile: {0.0, 0.5, 0.9, 0.99, 0.999, 1.0}) {
+        double const expected {1000.0*(1.0 + quantile*9999.0)};
+        double const actual {static_cast<double>(sketch.getQuantile(quantile).count())};
+        EXPECT_NEAR(actual, expected, expected*relative_accuracy + 1000.0);
+      }
+    }
+
+    TEST(QuantileSketchTest, valuesOutOfRangeAreClamped) {
+      myactuator_rmd::QuantileSketch sketch {0.01, std::chrono::microseconds(10), std::chrono::milliseconds(10)};
+      sketch.add(std::chrono::nanoseconds(1));
+      EXPECT_EQ(sketch.getQuantile(0.0), std::chrono::microseconds(10));
+      sketch.add(std::chrono::seconds(100));
+      EXPECT_LE(sketch.getQuantile(1.0), std::chrono::milliseconds(11));
+    }
+
+    TEST(QuantileSketchTest, decayFavoursRecentSamples) {
+      myactuator_rmd::QuantileSketch sketch {};
+      for (int i = 0; i < 100; ++i) {
+        sketch.add(std::chrono::milliseconds(10));
+      }
+      sketch.decay();
+      sketch.decay();
+      for (int i = 0; i < 100; ++i) {
+        sketch.add(std::chrono::microseconds(100));
+      }
+      EXPECT_EQ(sketch.getCount(), 125);
+      EXPECT_LT(sketch.getQuantile(0.75), std::chrono::microseconds(102));
+      sketch.clear();
+      EXPECT_EQ(sketch.getCount(), 0);
+    }
+
+    TEST(QuantileSketchTest, decayPreservesSparseTail) {
+      myactuator_rmd::QuantileSketch sketch {};
+      for (int i = 0; i < 9980; ++i) {
+        sketch.add(std::chrono::microseconds(100));
+      }
+      // Rare slow samples that each fall into a bucket of their own
+      double tail_value {5000.0};
+      for (int i = 0; i < 20; ++i) {
+        sketch.add(std::chrono::microseconds(static_cast<std::int64_t>(tail_value)));
+        tail_value *= 1.05;
+      }
+      auto const quantile_before {sketch.getQuantile(0.999)};
+      EXPECT_GE(quantile_before, std::chrono::milliseconds(5));
+      sketch.decay();
+      EXPECT_EQ(sketch.getCount(), 5000);
+      auto const quantile_after {sketch.getQuantile(0.999)};
+      EXPECT_GE(quantile_after, std::chrono::milliseconds(5));
+      EXPECT_NEAR(static_cast<double>(quantile_after.count()), static_cast<double>(quantile_before.count()),
+                  0.1*static_cast<double>(quantile_before.count()));
+    }
+
+    TEST(QuantileSketchTest, invalidAccuracy) {
+      EXPECT_THROW(myactuator_rmd::QuantileSketch{0.0}, myactuator_rmd::ValueRangeException);
+      EXPECT_THROW(myactuator_rmd::QuantileSketch{1.0}, myactuator_rmd::ValueRangeException);
+    }
+
+  }
+}
@@ -0,0 +1,107 @@
+/**
+ * \file state_cache_test.cpp
+ * \mainpage
+ *    Tests for the lock-free cache of the latest state of each actuator
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/telemetry/state_cache.hpp"
+#include "myactuator_rmd/actuator_interface.hpp"
+#include "../mock/driver_mock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(StateCacheTest, emptyCache) {
+      myactuator_rmd::StateCache const cache {};
+      EXPECT_FALSE(cache.getFeedback(1));
+      EXPECT_FALSE(cache.getMotorStatus1(1));
+      EXPECT_FALSE(cache.getResponse(1, CommandType::READ_MULTI_TURN_ANGLE));
+      EXPECT_FALSE(cache.getFeedback(0));
+      EXPECT_FALSE(cache.getFeedback(33));
+    }
+
+    TEST(StateCacheTest, latestResponses) {
+      myactuator_rmd::StateCache cache {};
+      std::chrono::steady_clock::time_point const timestamp {std::chrono::seconds(3)};
+      cache.onResponse(2, {0xA1, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, timestamp);
+      cache.onResponse(2, {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}, timestamp);
+      cache.onResponse(2, {0xB2, 0x00, 0x00, 0x00, 0x2E, 0x89, 0x34, 0x01}, timestamp);
+      cache.onResponse(40, {0x92, 0x00, 0x00, 0x00, 0xA0, 0x8C, 0x00, 0x00}, timestamp);
+      auto const feedback {cache.getFeedback(2)};
+      ASSERT_TRUE(feedback);
+      EXPECT_NEAR(feedback->shaft_speed, 500.0f, 0.1f);
+      EXPECT_FALSE(cache.getFeedback(1));
+      auto const angle {cache.getMultiTurnAngle(2)};
+      ASSERT_TRUE(angle);
+      EXPECT_NEAR(*angle, 360.0f, 0.1f);
+      auto const response {cache.getResponse(2, CommandType::SPEED_CLOSED_LOOP_CONTROL)};
+      ASSERT_TRUE(response);
+      EXPECT_EQ(response->data[0], 0xA1);
+      EXPECT_EQ(response->timestamp, timestamp);
+      EXPECT_FALSE(cache.getResponse(2, CommandType::READ_SYSTEM_SOFTWARE_VERSION_DATE));
+    }
+
+    TEST(StateCacheTest, consistentConcurrentReads) {
+      myactuator_rmd::StateCache cache {};
+      std::atomic<bool> is_running {true};
+      std::atomic<bool> has_written {false};
+      std::thread writer {[&cache, &is_running, &has_written]() {
+        for (std::uint8_t i = 0; is_running.load(); ++i) {
+          // All bytes apart from the command hold the same value so that torn reads can be detected
+          std::chrono::steady_clock::time_point const timestamp {std::chrono::nanoseconds(i)};
+          cache.onResponse(1, {0x9C, i, i, i, i, i, i, i}, timestamp);
+          has_written.store(true);
+        }
+        return;
+      }};
+      // Only start reading once the writer is running so that the reads overlap with the writes
+      while (!has_written.load()) {
+        std::this_thread::yield();
+      }
+      int num_read {0};
+      for (int i = 0; i < 100000; ++i) {
+        auto const response {cache.getResponse(1, CommandType::READ_MOTOR_STATUS_2)};
+        if (!response) {
+          continue;
+        }
+        ++num_read;
+        auto const value {response->data[1]};
+        for (std::size_t j = 2; j < response->data.size(); ++j) {
+          ASSERT_EQ(response->data[j], value);
+        }
+        ASSERT_EQ(response->timestamp.time_since_epoch().count(), value);
+      }
+      is_running.store(false);
+      writer.join();
+      EXPECT_EQ(num_read, 100000);
+    }
+
+    TEST(StateCacheTest, filledByThreadSafeDriver) {
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      EXPECT_CALL(driver_mock, sendRecv).WillOnce(::testing::Return(std::array<std::uint8_t,8>{0xA2, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}));
+      myactuator_rmd::StateCache cache {};
+      myactuator_rmd::ThreadSafeDriver driver {driver_mock};
+      driver.addListener(cache);
+      myactuator_rmd::ActuatorInterface actuator {driver, 1};
+      static_cast<void>(actuator.sendVelocitySetpoint(500.0f));
+      auto const feedback {cache.getFeedback(1)};
+      ASSERT_TRUE(feedback);
+      EXPECT_NEAR(feedback->shaft_angle, 45.0f, 0.1f);
+    }
+
+  }
+}
@@ -0,0 +1,64 @@
+/**
+ * \file state_history_test.cpp
+ * \mainpage
+ *    Tests for the compact history of raw responses
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <chrono>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/protocol/responses.hpp"
+#include "myactuator_rmd/telemetry/state_history.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(StateHistoryTest, compactRecords) {
+      static_assert(sizeof(myactuator_rmd::HistoryRecord) == 12);
+    }
+
+    TEST(StateHistoryTest, lazyDecoding) {
+      myactuator_rmd::StateHistory history {};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(10)};
+      history.push({0x9A, 0x32, 0x00, 0x00, 0xE8, 0x01, 0x00, 0x04}, start);
+      history.push({0xA1, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, start + std::chrono::microseconds(250));
+      ASSERT_EQ(history.size(), 2);
+      auto const status {history.getMotorStatus1(0)};
+      ASSERT_TRUE(status);
+      EXPECT_EQ(status->temperature, 50);
+      EXPECT_FALSE(history.getFeedback(0));
+      EXPECT_FALSE(history.getMotorStatus1(1));
+      EXPECT_FALSE(history.getMotorStatus3(1));
+      auto const feedback {history.getFeedback(1)};
+      ASSERT_TRUE(feedback);
+      EXPECT_NEAR(feedback->shaft_speed, 500.0f, 0.1f);
+      auto const response {history.getResponse<myactuator_rmd::SetTorqueResponse>(1)};
+      ASSERT_TRUE(response);
+      EXPECT_NEAR(response->getStatus().current, 1.0f, 0.01f);
+      EXPECT_FALSE(history.getResponse<myactuator_rmd::SetVelocityResponse>(1));
+      EXPECT_EQ(history.getTimestamp(0), start);
+      EXPECT_EQ(history.getTimestamp(1), start + std::chrono::microseconds(250));
+    }
+
+    TEST(StateHistoryTest, newSegmentOnOverflow) {
+      myactuator_rmd::StateHistory history {};
+      std::chrono::steady_clock::time_point const start {std::chrono::seconds(10)};
+      history.push({0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, start);
+      history.push({0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, start + std::chrono::hours(2));
+      history.push({0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, start + std::chrono::hours(2) + std::chrono::seconds(1));
+      history.push({0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00}, start);
+      EXPECT_EQ(history.getTimestamp(0), start);
+      EXPECT_EQ(history.getTimestamp(1), start + std::chrono::hours(2));
+      EXPECT_EQ(history.getTimestamp(2), start + std::chrono::hours(2) + std::chrono::seconds(1));
+      EXPECT_EQ(history.getTimestamp(3), start);
+      history.clear();
+      EXPECT_EQ(history.size(), 0);
+    }
+
+  }
+}
@@ -0,0 +1,102 @@
+/**
+ * \file telemetry_poller_test.cpp
+ * \mainpage
+ *    Tests for polling the state of actuators in the background
+ * \author
+ *    Tobit Flatscher (github.com/2b-t)
+*/
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "myactuator_rmd/actuator_state/can_baud_rate.hpp"
+#include "myactuator_rmd/driver/thread_safe_driver.hpp"
+#include "myactuator_rmd/protocol/command_type.hpp"
+#include "myactuator_rmd/protocol/message.hpp"
+#include "myactuator_rmd/telemetry/state_cache.hpp"
+#include "myactuator_rmd/telemetry/telemetry_poller.hpp"
+#include "myactuator_rmd/exceptions.hpp"
+#include "../mock/driver_mock.hpp"
+
+
+namespace myactuator_rmd {
+  namespace test {
+
+    TEST(TelemetryPollerTest, pollsAtDesiredRates) {
+      using namespace std::literals::chrono_literals;
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      std::atomic<int> num_status_1 {0};
+      std::atomic<int> num_status_2 {0};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([&](Message const& request, std::uint32_t const) {
+        auto const command {request.getData()[0]};
+        if (command == CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG) {
+          ++num_status_1;
+          return std::array<std::uint8_t,8>{0x9A, 0x32, 0x00, 0x01, 0xE5, 0x01, 0x00, 0x00};
+        }
+        ++num_status_2;
+        return std::array<std::uint8_t,8>{0x9C, 0x32, 0x64, 0x00, 0xF4, 0x01, 0x2D, 0x00};
+      });
+      StateCache state_cache {};
+      ThreadSafeDriver driver {driver_mock};
+      driver.addListener(state_cache);
+      {
+        TelemetryPoller const poller {driver, {
+          TelemetryRequest{1, CommandType::READ_MOTOR_STATUS_1_AND_ERROR_FLAG, 10.0f},
+          TelemetryRequest{1, CommandType::READ_MOTOR_STATUS_2, 100.0f}
+        }, CanBaudRate::MBPS1, 0.5f};
+        std::this_thread::sleep_for(350ms);
+        EXPECT_EQ(poller.getNumErrors(), 0);
+        EXPECT_EQ(poller.getNumPolls(), num_status_1 + num_status_2);
+      }
+      EXPECT_GE(num_status_1, 2);
+      EXPECT_LE(num_status_1, 6);
+      EXPECT_GE(num_status_2, 20);
+      EXPECT_LE(num_status_2, 40);
+
+      auto const motor_status_1 {state_cache.getMotorStatus1(1)};
+      ASSERT_TRUE(motor_status_1.has_value());
+      EXPECT_EQ(motor_status_1->temperature, 50);
+      EXPECT_NEAR(motor_status_1->voltage, 48.5f, 0.1f);
+      auto const motor_status_2 {state_cache.getFeedback(1)};
+      ASSERT_TRUE(motor_status_2.has_value());
+      EXPECT_NEAR(motor_status_2->current, 1.0f, 0.01f);
+      EXPECT_FALSE(state_cache.getMotorStatus3(1).has_value());
+      EXPECT_FALSE(state_cache.getFeedback(2).has_value());
+    }
+
+    TEST(TelemetryPollerTest, staysBelowUtilisationCeiling) {
+      using namespace std::literals::chrono_literals;
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      ON_CALL(driver_mock, sendRecv).WillByDefault([](Message const& request, std::uint32_t const) {
+        return request.getData();
+      });
+      ThreadSafeDriver driver {driver_mock};
+      // A read at 500 kbps takes 540us of bus time, a ceiling of 5.4% therefore allows for 100 reads per second
+      TelemetryPoller const poller {driver, {
+        TelemetryRequest{1, CommandType::READ_MOTOR_STATUS_2, 1000.0f}
+      }, CanBaudRate::KBPS500, 0.054f};
+      EXPECT_NEAR(poller.getRequiredUtilisation(), 0.54f, 0.001f);
+      std::this_thread::sleep_for(200ms);
+      EXPECT_GE(poller.getNumPolls(), 10);
+      EXPECT_LE(poller.getNumPolls(), 25);
+      EXPECT_GE(poller.getNumThrottled(), 1);
+    }
+
+    TEST(TelemetryPollerTest, rejectsInvalidRequests) {
+      ::testing::NiceMock<DriverMock> driver_mock {};
+      ThreadSafeDriver driver {driver_mock};
+      EXPECT_THROW((TelemetryPoller{driver, {TelemetryRequest{1, CommandType::TORQUE_CLOSED_LOOP_CONTROL, 10.0f}}}),
+                   myactuator_rmd::ValueRangeException);
+      EXPECT_THROW((TelemetryPoller{driver, {TelemetryRequest{1, CommandType::READ_MOTOR_STATUS_2, 0.0f}}}),
+                   myactuator_rmd::ValueRangeException);
+      EXPECT_THROW((TelemetryPoller{driver, {}, CanBaudRate::MBPS1, 1.5f}), myactuator_rmd::ValueRangeException);
+    }
+
+  }
+}